@@ -0,0 +1,224 @@
+#include <stdio.h>
+#include <string.h>
+#include <stdatomic.h>
+
+#include "CommandQueue.h"
+#include "serial.h"
+
+
+#if defined(__linux__) || defined(__FreeBSD__)   /* Linux & FreeBSD */
+
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+
+static pthread_t senderThread;
+
+#else  /* windows */
+
+#include <windows.h>
+
+static HANDLE senderThread;
+
+#endif
+
+#define QUEUE_MASK (COMMAND_QUEUE_SLOTS - 1)
+#define CACHE_LINE 64
+
+// Single-producer/single-consumer ring of formatted commands
+// The main thread only writes head and the sender thread only writes tail, so no lock is needed:
+// a slot is filled before head is published (release) and read after head is seen (acquire), and the
+// same pairing on tail hands the slot back. head and tail sit on separate cache lines so the two
+// threads do not keep stealing one line from each other.
+typedef struct {
+    char line[COMMAND_QUEUE_SLOTS][COMMAND_LINE_MAX];
+    _Alignas(CACHE_LINE) atomic_uint head;     // Commands queued so far (next slot to fill before masking)
+    _Alignas(CACHE_LINE) atomic_uint tail;     // Commands taken by the sender so far
+    _Alignas(CACHE_LINE) atomic_int closed;    // Set by StopCommandSender after the last command
+    atomic_int failed;                         // Set by the sender once the robot stopped answering
+} CommandQueue;
+
+static CommandQueue queue;
+static int senderRunning = 0;                  // 0 when commands are sent straight from the main thread
+static int senderResult = 0;                   // FlushCommands' result, returned by StopCommandSender
+
+// Helper function: waits a little for the other thread before checking the queue again
+// Yields first, which is enough when the other thread is just about to move, then sleeps so that
+// waiting on the robot for a long move does not keep a core busy
+static void Backoff(int attempt)
+{
+#if defined(__linux__) || defined(__FreeBSD__)
+    if (attempt < 64)
+    {
+        sched_yield();
+    }
+    else
+    {
+        struct timespec pause = {0, 200000};   // 0.2 ms
+        nanosleep(&pause, NULL);
+    }
+#else
+    if (attempt < 64)
+    {
+        SwitchToThread();
+    }
+    else
+    {
+        Sleep(1);
+    }
+#endif
+}
+
+// Helper function: the sender thread's loop
+// Streams every queued command with StreamCommand until the queue is closed and empty
+static void SendQueuedCommands(void)
+{
+    unsigned tail = atomic_load_explicit(&queue.tail, memory_order_relaxed);
+
+    while (1)
+    {
+        int attempt = 0;
+        while (tail == atomic_load_explicit(&queue.head, memory_order_acquire))
+        {
+            if (attempt == 0 && FlushTransmit() != 0)  // Send the batch before waiting for the generator
+            {
+                atomic_store_explicit(&queue.failed, 1, memory_order_release);
+            }
+            if (atomic_load_explicit(&queue.closed, memory_order_acquire) &&
+                tail == atomic_load_explicit(&queue.head, memory_order_acquire))
+            {
+                senderResult = atomic_load_explicit(&queue.failed, memory_order_relaxed) ? -1 : FlushCommands();   // Nothing more will come, wait for the last acknowledgements
+                return;
+            }
+            Backoff(attempt++);
+        }
+
+        if (!atomic_load_explicit(&queue.failed, memory_order_relaxed))
+        {
+            if (StreamCommand(queue.line[tail & QUEUE_MASK]) < 0 && StreamFailed())
+            {
+                atomic_store_explicit(&queue.failed, 1, memory_order_release);
+            }
+        }                                          // After a failure the queue is only drained so the generator never blocks
+
+        tail++;
+        atomic_store_explicit(&queue.tail, tail, memory_order_release);    // Hand the slot back to the generator
+    }
+}
+
+#if defined(__linux__) || defined(__FreeBSD__)
+static void *SenderThread(void *unused)
+{
+    (void)unused;
+    SendQueuedCommands();
+    return NULL;
+}
+#else
+static DWORD WINAPI SenderThread(LPVOID unused)
+{
+    (void)unused;
+    SendQueuedCommands();
+    return 0;
+}
+#endif
+
+// Function: starts the sender thread
+// From here on G-code is generated on the main thread while the sender keeps the serial link busy
+// Returns: 0 when successful, -1 if no thread could be created (commands are then sent directly)
+int StartCommandSender(void)
+{
+    atomic_store(&queue.head, 0);
+    atomic_store(&queue.tail, 0);
+    atomic_store(&queue.closed, 0);
+    atomic_store(&queue.failed, 0);
+
+#if defined(__linux__) || defined(__FreeBSD__)
+    if (pthread_create(&senderThread, NULL, SenderThread, NULL) != 0)
+    {
+        return -1;
+    }
+#else
+    senderThread = CreateThread(NULL, 0, SenderThread, NULL, 0, NULL);
+    if (senderThread == NULL)
+    {
+        return -1;
+    }
+#endif
+
+    senderRunning = 1;
+    return 0;
+}
+
+// Function: copies one formatted command into the next free slot
+// Waits while the queue is full, which keeps the generator at most COMMAND_QUEUE_SLOTS lines ahead of the robot
+// Returns: 0 when queued, -1 if the command is too long or the robot has stopped answering
+int QueueCommand(char *buffer)
+{
+    if (!senderRunning)
+    {
+        if (StreamCommand(buffer) != 0)            // No sender thread, send from the calling thread
+        {
+            return -1;
+        }
+        return FlushTransmit();                    // Nothing else is sent until the next command
+    }
+
+    size_t length = strlen(buffer);
+    if (length >= COMMAND_LINE_MAX)
+    {
+        printf("Command too long to queue: %s\n", buffer);
+        return -1;
+    }
+
+    unsigned head = atomic_load_explicit(&queue.head, memory_order_relaxed);
+    int attempt = 0;
+    while (head - atomic_load_explicit(&queue.tail, memory_order_acquire) == COMMAND_QUEUE_SLOTS)
+    {
+        if (atomic_load_explicit(&queue.failed, memory_order_acquire))
+        {
+            return -1;
+        }
+        Backoff(attempt++);                        // Queue full: the robot is the bottleneck
+    }
+
+    if (atomic_load_explicit(&queue.failed, memory_order_acquire))
+    {
+        return -1;
+    }
+
+    memcpy(queue.line[head & QUEUE_MASK], buffer, length + 1);
+    atomic_store_explicit(&queue.head, head + 1, memory_order_release);    // Publish the filled slot
+    return 0;
+}
+
+// Function: reports whether the sender has given up on the robot
+int CommandSenderFailed(void)
+{
+    if (!senderRunning)
+    {
+        return StreamFailed();
+    }
+    return atomic_load_explicit(&queue.failed, memory_order_acquire);
+}
+
+// Function: lets the sender finish the queued commands, waits for their acknowledgements and ends the thread
+// Returns: number of lines the robot answered with "error", -1 if it stopped answering
+int StopCommandSender(void)
+{
+    if (!senderRunning)
+    {
+        return FlushCommands();
+    }
+
+    atomic_store_explicit(&queue.closed, 1, memory_order_release);
+
+#if defined(__linux__) || defined(__FreeBSD__)
+    pthread_join(senderThread, NULL);
+#else
+    WaitForSingleObject(senderThread, INFINITE);
+    CloseHandle(senderThread);
+#endif
+
+    senderRunning = 0;
+    return senderResult;
+}
@@ -0,0 +1,13 @@
+#ifndef COMMANDQUEUE_H_INCLUDED
+#define COMMANDQUEUE_H_INCLUDED
+
+
+#define COMMAND_QUEUE_SLOTS 256        /* Formatted commands the generator may run ahead of the sender (power of two) */
+#define COMMAND_LINE_MAX    128        /* Longest command, including its newline and terminating zero */
+
+int StartCommandSender(void);          // Start the thread that streams queued commands to the robot, -1 if it could not be started
+int QueueCommand(char *buffer);        // Copy a command into the queue, waiting while it is full; -1 once the robot stopped answering
+int CommandSenderFailed(void);         // 1 once the robot has stopped answering
+int StopCommandSender(void);           // Send what is left and wait for the acknowledgements; returns FlushCommands' result
+
+#endif // COMMANDQUEUE_H_INCLUDED
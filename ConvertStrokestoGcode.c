@@ -1,65 +1,71 @@
 #include <stdio.h>           
 
-// Data structure for character strokes
-typedef struct {
-    int   ascii;             // ASCII code of the character
-    int   nMoves;            // Total number of stroke movements
-    float *X;                // Array of scaled X coordinates
-    float *Y;                // Array of scaled Y coordinates
-    int   *Z;                // Array of pen states
-} StrokeData;
-
-// Function: sends formatted G-code string to robot (defined in main.c)
-void SendCommands(char *buffer);
+#include "StrokeBuffer.h"
+#include "GcodeEmitter.h"
 
 // Function: converts positioned stroke data into complete a G-code sequence for the robot to execute
 // Processes every stroke point, generating pen up/down (S0/S1000) and movement (G0/G1) commands
-// Inputs: chars array (scaled coordinates), nChars (character count), buffer (for sprintf formatting)
+// With arcTolerance > 0, runs of pen-down points that lie on a circle are drawn with one G2/G3 each
+// Inputs: strokes (page coordinates from TransformStrokes), emitter (formats the lines and sends them on),
+//         arcTolerance (mm the arc may stray from the points, 0 for straight lines only)
 // No return value - sends commands immediately
-void ConvertStrokestoGcode(StrokeData *chars, int nChars, char *buffer)
+void ConvertStrokestoGcode(const StrokeBuffer *strokes, GcodeEmitter *emitter, float arcTolerance)
 {
     int currentPenState = 0;     // Initialize assuming pen starts in UP position
 
-    for (int charIdx = 0; charIdx < nChars; charIdx++)      // Iterate through every character in the word
+    for (int strokeIdx = 0; strokeIdx < strokes->nPoints; strokeIdx++)     // Check every individual stroke point of the word
     {
-        for (int strokeIdx = 0; strokeIdx < chars[charIdx].nMoves; strokeIdx++)     // Check every individual stroke point within this character
-        {
-            float targetX = chars[charIdx].X[strokeIdx];     // Destination X position
-            float targetY = chars[charIdx].Y[strokeIdx];     // Destination Y position 
-            int   penState = chars[charIdx].Z[strokeIdx];    // Required pen state (0=up, 1=down)
+        float targetX = strokes->X[strokeIdx];           // Destination X position
+        float targetY = strokes->Y[strokeIdx];           // Destination Y position 
+        int   penState = strokes->Z[strokeIdx];          // Required pen state (0=up, 1=down)
 
-            if (penState == 0)      //If pen up                           
+        if (penState == 0)      //If pen up                           
+        {
+            if (currentPenState)
             {
-                if (currentPenState)
-                {
-                    sprintf(buffer, "S0\n");                 // S0 = pen up
-                    SendCommands(buffer);                    // Transmit command to robot using function
-                    currentPenState = 0;                     // Update internal state tracker
-                }
+                EmitPen(emitter, 0);                     // S0 = pen up
+                currentPenState = 0;                     // Update internal state tracker
+            }
+
+            EmitMove(emitter, 0, targetX, targetY);      // G0 = linear move
+        }
 
-                sprintf(buffer, "G0 X%.3f Y%.3f\n", targetX, targetY);  // G0 = linear move
-                SendCommands(buffer);                        // Send positioning command
+        else        // Pen down state                                 
+        {
+            if (!currentPenState)
+            {
+                EmitPen(emitter, 1);                     // S1000 = pen down
+                currentPenState = 1;                     // Update internal state tracker
             }
 
-            else        // Pen down state                                 
+            if (arcTolerance > 0.0f && strokeIdx > 0)    // The pen is at the previous point: try an arc from there
             {
-                if (!currentPenState)
+                int runEnd = strokeIdx;                  // Last pen-down point of this polyline
+                while (runEnd + 1 < strokes->nPoints && strokes->Z[runEnd + 1])
                 {
-                    sprintf(buffer, "S1000\n");              // S1000 = pen down
-                    SendCommands(buffer);                    // Transmit to robot
-                    currentPenState = 1;                     // Update internal state tracker
+                    runEnd++;
                 }
 
-                sprintf(buffer, "G1 X%.3f Y%.3f\n", targetX, targetY);  // G1 = linear move
-                SendCommands(buffer);                        // Send drawing command
+                StrokeArc arc;
+                if (FitArc(strokes, strokeIdx - 1, runEnd, arcTolerance, &arc) >= 0 &&
+                    EmitArc(emitter, arc.counterClockwise, strokes->X[arc.end], strokes->Y[arc.end],
+                            arc.centreX, arc.centreY) == 0)
+                {
+                    for (int arcIdx = strokeIdx; arcIdx <= arc.end; arcIdx++)
+                    {
+                        CountReplacedMove(emitter, strokes->X[arcIdx], strokes->Y[arcIdx]);
+                    }
+                    strokeIdx = arc.end;                 // Carry on after the arc's last point
+                    continue;
+                }
             }
+
+            EmitMove(emitter, 1, targetX, targetY);      // G1 = linear move
         }
     }
     
     if (currentPenState)
     {
-        sprintf(buffer, "S0\n");                         // Final pen up command ( for safety)
-        SendCommands(buffer);                            // Transmit final safety command
+        EmitPen(emitter, 0);                             // Final pen up command ( for safety)
     }
 }
-
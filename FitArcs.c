@@ -0,0 +1,112 @@
+#include <math.h>
+
+#include "StrokeBuffer.h"
+
+#define ARC_MIN_SEGMENTS 3               /* Segments an arc must replace; any three points lie on some circle */
+#define ARC_MAX_RADIUS   500.0f          /* mm; flatter runs are straight lines as far as the plotter can tell */
+#define ARC_MAX_SWEEP    6.0f            /* Radians; stays clear of a full circle, where end point == start point */
+
+// Helper function: centre and radius of the circle through three points
+// Returns: 0 when successful, -1 if the points are (nearly) collinear
+static int CircleThrough(float x0, float y0, float x1, float y1, float x2, float y2,
+                         float *centreX, float *centreY, float *radius)
+{
+    double ax = x1 - x0, ay = y1 - y0;           // Relative to the first point, for precision
+    double bx = x2 - x0, by = y2 - y0;
+    double det = 2.0 * (ax * by - ay * bx);
+    if (fabs(det) < 1e-9)
+    {
+        return -1;
+    }
+
+    double a2 = ax * ax + ay * ay;
+    double b2 = bx * bx + by * by;
+    double cx = (by * a2 - ay * b2) / det;
+    double cy = (ax * b2 - bx * a2) / det;
+
+    *centreX = (float)(x0 + cx);
+    *centreY = (float)(y0 + cy);
+    *radius = (float)sqrt(cx * cx + cy * cy);
+    return 0;
+}
+
+// Helper function: checks that points first..last follow the circle within tolerance, turning one way only
+// Each segment is compared with the piece of arc between its end points' angles: the segment lies within the
+// larger radial error of its end points of that piece's chord, and the chord within its sagitta of the arc, so
+// the two together bound how far the arc strays from the segment, and they must stay within tolerance.
+// Returns: 1 (counter-clockwise) or -1 (clockwise) when the run fits, 0 when it does not
+static int FollowsCircle(const StrokeBuffer *strokes, int first, int last, float centreX, float centreY,
+                         float radius, float tolerance)
+{
+    double sweep = 0.0;
+    int direction = 0;
+    float dx = strokes->X[first] - centreX;
+    float dy = strokes->Y[first] - centreY;
+    float error = fabsf(sqrtf(dx * dx + dy * dy) - radius);      // Radial error of the segment's first point
+
+    for (int pointIdx = first; pointIdx < last; pointIdx++)
+    {
+        float nx = strokes->X[pointIdx + 1] - centreX;
+        float ny = strokes->Y[pointIdx + 1] - centreY;
+        float nextError = fabsf(sqrtf(nx * nx + ny * ny) - radius);
+        double cross = (double)dx * ny - (double)dy * nx;
+        double dot = (double)dx * nx + (double)dy * ny;
+        int turn = (cross > 0.0) ? 1 : -1;
+        if (cross == 0.0 || (direction != 0 && turn != direction) || dot <= 0.0)
+        {
+            return 0;                                // Backtracks, stands still or jumps by a quarter turn or more
+        }
+        direction = turn;
+
+        double angle = atan2(fabs(cross), dot);      // Below a quarter turn, so the sagitta is well defined
+        double sagitta = radius * (1.0 - cos(0.5 * angle));
+        if (((error > nextError) ? error : nextError) + sagitta > tolerance)
+        {
+            return 0;                                // The arc strays too far from this segment
+        }
+        sweep += angle;
+
+        dx = nx;
+        dy = ny;
+        error = nextError;
+    }
+
+    return (sweep < ARC_MAX_SWEEP) ? direction : 0;
+}
+
+// Function: finds the longest circular arc that starts at point 'first' of a pen-down polyline
+// Grows the run one point at a time through 'last'; each candidate circle passes through the first, middle and
+// final point of the run, and the run ends at the first point that no longer fits.
+// Inputs: strokes, first (arc start, already reached by the pen), last (final pen-down point of the polyline),
+//         tolerance (mm), arc (receives the arc)
+// Returns: index of the arc's end point, -1 if no arc of at least ARC_MIN_SEGMENTS segments starts at first
+int FitArc(const StrokeBuffer *strokes, int first, int last, float tolerance, StrokeArc *arc)
+{
+    int best = -1;
+
+    for (int end = first + ARC_MIN_SEGMENTS; end <= last; end++)
+    {
+        int middle = (first + end) / 2;
+        float centreX, centreY, radius;
+
+        if (CircleThrough(strokes->X[first], strokes->Y[first], strokes->X[middle], strokes->Y[middle],
+                          strokes->X[end], strokes->Y[end], &centreX, &centreY, &radius) != 0 ||
+            radius > ARC_MAX_RADIUS)
+        {
+            break;                                   // Straight: a longer run will not bend back into an arc
+        }
+
+        int direction = FollowsCircle(strokes, first, end, centreX, centreY, radius, tolerance);
+        if (direction == 0)
+        {
+            break;
+        }
+
+        best = end;
+        arc->end = end;
+        arc->centreX = centreX;
+        arc->centreY = centreY;
+        arc->counterClockwise = (direction > 0);
+    }
+    return best;
+}
@@ -0,0 +1,99 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "StrokeFont.h"
+
+// Function: loads a binary font file by memory-mapping it
+// The glyph table points straight into the mapped file, so nothing is parsed or allocated per glyph
+// Inputs: path of the binary font file, destination FontTable
+// Returns: number of glyphs loaded when successful, -1 if the file is missing or not a valid binary font
+int LoadFontBinary(const char *path, FontTable *font)
+{
+    memset(font, 0, sizeof(*font));              // Start with every glyph undefined
+
+    if (MapFile(path, &font->map) != 0)
+    {
+        return -1;                               // No binary font available
+    }
+
+    const FontBinaryHeader *header = font->map.data;
+    if (font->map.size < sizeof(FontBinaryHeader) ||
+        header->magic != FONT_BINARY_MAGIC ||
+        header->version != FONT_BINARY_VERSION)
+    {
+        FreeFontTable(font);
+        return -1;                               // Not a binary font, or written by another version or byte order
+    }
+
+    size_t nPoints = header->nPoints;
+    if ((font->map.size - sizeof(FontBinaryHeader)) / sizeof(StrokePoint) < nPoints)
+    {
+        FreeFontTable(font);
+        return -1;                               // File is shorter than its header claims
+    }
+
+    const StrokePoint *points = (const StrokePoint *)(header + 1);   // Packed points follow the header
+
+    for (int asciiValue = 0; asciiValue < FONT_TABLE_SIZE; asciiValue++)
+    {
+        uint32_t start = header->glyphs[asciiValue].start;
+        int32_t moveCount = header->glyphs[asciiValue].nMoves;
+
+        if (moveCount < 0)
+        {
+            continue;                            // Character is not in the font
+        }
+        if (start > nPoints || (size_t)moveCount > nPoints - start)
+        {
+            FreeFontTable(font);
+            return -1;                           // Glyph points outside the point array
+        }
+
+        font->glyphs[asciiValue].defined = 1;
+        font->glyphs[asciiValue].nMoves = moveCount;
+        font->glyphs[asciiValue].points = points + start;
+        ComputeGlyphMetrics(&font->glyphs[asciiValue]);
+    }
+
+    font->nPoints = (int)nPoints;
+    return (int)header->nGlyphs;
+}
+
+// Function: writes a loaded FontTable as a binary font file
+// Used by the MakeBinaryFont converter tool; the points of each glyph are written in ASCII order
+// Inputs: output file opened in binary mode, loaded FontTable
+// Returns: 0 when successful, -1 on write failure
+int SaveFontBinary(FILE *out, const FontTable *font)
+{
+    FontBinaryHeader header;
+    uint32_t nPoints = 0;
+
+    memset(&header, 0, sizeof(header));
+    header.magic = FONT_BINARY_MAGIC;
+    header.version = FONT_BINARY_VERSION;
+
+    for (int asciiValue = 0; asciiValue < FONT_TABLE_SIZE; asciiValue++)
+    {
+        const GlyphData *glyph = &font->glyphs[asciiValue];
+
+        header.glyphs[asciiValue].nMoves = glyph->defined ? glyph->nMoves : -1;
+        header.glyphs[asciiValue].start = glyph->defined ? nPoints : 0;
+        if (glyph->defined)
+        {
+            header.nGlyphs++;
+            nPoints += (uint32_t)glyph->nMoves;
+        }
+    }
+    header.nPoints = nPoints;
+
+    int failed = (fwrite(&header, sizeof(header), 1, out) != 1);
+
+    for (int asciiValue = 0; asciiValue < FONT_TABLE_SIZE && !failed; asciiValue++)
+    {
+        const GlyphData *glyph = &font->glyphs[asciiValue];
+        if (glyph->defined && glyph->nMoves > 0)
+            failed = (fwrite(glyph->points, sizeof(StrokePoint), (size_t)glyph->nMoves, out) != (size_t)glyph->nMoves);
+    }
+
+    return failed ? -1 : 0;
+}
@@ -0,0 +1,467 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "GcodeEmitter.h"
+#include "GcodeFormat.h"
+
+#define FULL_DECIMALS 3          // Decimals of the full line format, used as the reference for bytes saved
+#define ARC_RADIUS_ERROR 0.002   // mm; GRBL rejects arcs whose start and end radius differ by more than 0.005 mm
+
+// Helper function: hands the finished line to the sink and counts it
+static void SendLine(GcodeEmitter *emitter, char *end)
+{
+    emitter->lines++;
+    emitter->bytes += (unsigned long long)(end - emitter->line);
+    emitter->sink(emitter->line);
+}
+
+// Helper function: bytes of the full "G0 X1.000 Y2.000\n" line for a move, for the bytes saved report
+static size_t FullMoveLength(float x, float y)
+{
+    char number[GCODE_NUMBER_MAX];
+    size_t length = 3 + 1 + 2 + 1;                          // "G0 " "X" " Y" "\n" around the numbers
+
+    length += (size_t)(FormatCoordinate(number, x, FULL_DECIMALS, 0) - number);
+    length += (size_t)(FormatCoordinate(number, y, FULL_DECIMALS, 0) - number);
+    return length;
+}
+
+// Helper function: writes a coordinate given in steps
+// Full lines keep every decimal; compact lines drop trailing zeros and the zero before the point (".5", "-.25")
+static char *WriteSteps(const GcodeEmitter *emitter, char *out, long long steps)
+{
+    char number[GCODE_NUMBER_MAX];
+    const char *text = number;
+
+    FormatFixedPoint(number, steps * emitter->stepUnits, emitter->decimals, emitter->compact);
+    if (emitter->compact)
+    {
+        if (text[0] == '-' && text[1] == '0' && text[2] == '.')
+        {
+            *out++ = '-';
+            text += 2;
+        }
+        else if (text[0] == '0' && text[1] == '.')
+        {
+            text += 1;
+        }
+    }
+    while (*text) *out++ = *text++;
+    return out;
+}
+
+// Helper function: sends S0 or S1000
+static void SendPen(GcodeEmitter *emitter, int down)
+{
+    emitter->pen = down;
+    strcpy(emitter->line, down ? "S1000\n" : "S0\n");
+    SendLine(emitter, emitter->line + (down ? 6 : 3));
+}
+
+// Helper function: tells whether a move to x, y would end where the controller already is
+static int IsAtPosition(const GcodeEmitter *emitter, float x, float y)
+{
+    return emitter->havePosition &&
+           llrint((double)x * emitter->unitsPerMm) == emitter->lastX &&
+           llrint((double)y * emitter->unitsPerMm) == emitter->lastY;
+}
+
+// Helper function: tells whether the held back travel is a gap short enough to draw through
+static int IsShortGap(const GcodeEmitter *emitter)
+{
+    if (emitter->joinDistance <= 0.0f || !emitter->havePosition)
+    {
+        return 0;
+    }
+
+    double dx = (double)(llrint((double)emitter->travelX * emitter->unitsPerMm) - emitter->lastX);
+    double dy = (double)(llrint((double)emitter->travelY * emitter->unitsPerMm) - emitter->lastY);
+    return hypot(dx, dy) / emitter->unitsPerMm <= emitter->joinDistance;
+}
+
+// Helper function: starts a coordinate line with G90 or G91 when the controller is in the other distance mode
+static char *WriteDistanceMode(GcodeEmitter *emitter, char *out)
+{
+    if (emitter->relative == emitter->incremental)
+    {
+        return out;
+    }
+
+    *out++ = 'G';
+    *out++ = '9';
+    *out++ = emitter->relative ? '1' : '0';
+    if (!emitter->compact) *out++ = ' ';
+    emitter->incremental = emitter->relative;
+    return out;
+}
+
+// Helper function: writes one G0/G1 line
+// Coordinates are rounded to the emitter's grid. In compact mode the motion word and each axis are only
+// written when they differ from what the controller already has. A relative emitter writes the distance
+// from the previous position instead of the position.
+static void SendMove(GcodeEmitter *emitter, int draw, float x, float y)
+{
+    char *out = emitter->line;
+    long long stepsX = llrint((double)x * emitter->unitsPerMm);
+    long long stepsY = llrint((double)y * emitter->unitsPerMm);
+    int sendX = !emitter->havePosition || stepsX != emitter->lastX;
+    int sendY = !emitter->havePosition || stepsY != emitter->lastY;
+    long long valueX = emitter->relative ? stepsX - emitter->lastX : stepsX;
+    long long valueY = emitter->relative ? stepsY - emitter->lastY : stepsY;
+
+    emitter->havePosition = 1;
+    emitter->lastX = stepsX;
+    emitter->lastY = stepsY;
+
+    out = WriteDistanceMode(emitter, out);
+    if (!emitter->compact)
+    {
+        emitter->motion = draw;
+        *out++ = 'G';
+        *out++ = draw ? '1' : '0';
+        *out++ = ' ';
+        *out++ = 'X';
+        if (!emitter->quantize && !emitter->relative)
+            out = FormatCoordinate(out, x, FULL_DECIMALS, 0);   // Exactly printf's "%.3f"
+        else
+            out = WriteSteps(emitter, out, valueX);
+        *out++ = ' ';
+        *out++ = 'Y';
+        if (!emitter->quantize && !emitter->relative)
+            out = FormatCoordinate(out, y, FULL_DECIMALS, 0);
+        else
+            out = WriteSteps(emitter, out, valueY);
+        *out++ = '\n';
+        *out = 0;
+        SendLine(emitter, out);
+        return;
+    }
+
+    if (emitter->motion != draw)                            // G0, G1, G2 and G3 are modal: only written on a change
+    {
+        *out++ = 'G';
+        *out++ = draw ? '1' : '0';
+        emitter->motion = draw;
+    }
+    if (sendX)
+    {
+        *out++ = 'X';
+        out = WriteSteps(emitter, out, valueX);
+    }
+    if (sendY)
+    {
+        *out++ = 'Y';
+        out = WriteSteps(emitter, out, valueY);
+    }
+    *out++ = '\n';
+    *out = 0;
+    SendLine(emitter, out);
+}
+
+// Helper function: sends the held back travel, preceded by the held back lift if the pen really moves
+// A travel that ends where the pen already is goes nowhere and is dropped; the lift then stays held back
+static void FlushTravel(GcodeEmitter *emitter)
+{
+    if (!emitter->pendingTravel)
+    {
+        return;
+    }
+    emitter->pendingTravel = 0;
+
+    if (IsAtPosition(emitter, emitter->travelX, emitter->travelY))
+    {
+        emitter->movesDropped++;
+        return;
+    }
+    if (emitter->pendingLift)
+    {
+        emitter->pendingLift = 0;
+        SendPen(emitter, 0);
+    }
+    SendMove(emitter, 0, emitter->travelX, emitter->travelY);
+}
+
+// Helper function: sends everything held back, so the controller ends up where it was asked to be
+static void FlushPending(GcodeEmitter *emitter)
+{
+    FlushTravel(emitter);
+    if (emitter->pendingLift)
+    {
+        emitter->pendingLift = 0;
+        SendPen(emitter, 0);
+    }
+}
+
+// Function: draws a circular arc from the current position to x, y around centreX, centreY
+// G2 turns clockwise, G3 counter-clockwise; I and J give the centre relative to the start. Both are computed
+// from the rounded coordinates actually sent, so the controller sees the same radius at both ends.
+// Returns: 0 when the arc was sent, -1 if it was not (start position unknown, or the rounding of a coarse
+//          -q grid would leave the ends on different circles); the caller then draws the points with G1
+int EmitArc(GcodeEmitter *emitter, int counterClockwise, float x, float y, float centreX, float centreY)
+{
+    if (emitter->optimize)
+    {
+        FlushPending(emitter);
+    }
+    if (!emitter->havePosition)
+    {
+        return -1;
+    }
+
+    long long stepsX = llrint((double)x * emitter->unitsPerMm);
+    long long stepsY = llrint((double)y * emitter->unitsPerMm);
+    long long stepsI = llrint((double)centreX * emitter->unitsPerMm) - emitter->lastX;
+    long long stepsJ = llrint((double)centreY * emitter->unitsPerMm) - emitter->lastY;
+    double startRadius = hypot((double)stepsI, (double)stepsJ) / emitter->unitsPerMm;
+    double endRadius = hypot((double)(emitter->lastX + stepsI - stepsX), (double)(emitter->lastY + stepsJ - stepsY)) / emitter->unitsPerMm;
+    if (fabs(startRadius - endRadius) > ARC_RADIUS_ERROR || (stepsX == emitter->lastX && stepsY == emitter->lastY))
+    {
+        return -1;                                          // Would be an error 33, or a full circle
+    }
+
+    char *out = WriteDistanceMode(emitter, emitter->line);
+    int code = counterClockwise ? 3 : 2;
+    if (!emitter->compact || emitter->motion != code)
+    {
+        *out++ = 'G';
+        *out++ = (char)('0' + code);
+        if (!emitter->compact) *out++ = ' ';
+    }
+    emitter->motion = code;
+
+    *out++ = 'X';
+    out = WriteSteps(emitter, out, emitter->relative ? stepsX - emitter->lastX : stepsX);
+    if (!emitter->compact) *out++ = ' ';
+    *out++ = 'Y';
+    out = WriteSteps(emitter, out, emitter->relative ? stepsY - emitter->lastY : stepsY);
+    if (!emitter->compact) *out++ = ' ';
+    *out++ = 'I';
+    out = WriteSteps(emitter, out, stepsI);
+    if (!emitter->compact) *out++ = ' ';
+    *out++ = 'J';
+    out = WriteSteps(emitter, out, stepsJ);
+    *out++ = '\n';
+    *out = 0;
+
+    emitter->lastX = stepsX;
+    emitter->lastY = stepsY;
+    SendLine(emitter, out);
+    return 0;
+}
+
+// Function: prepares an emitter for a G91 fragment, e.g. one glyph, with the settings of another emitter
+// The fragment starts at its own origin (0,0) with the pen up and the controller in G90; its first coordinate
+// line switches to G91, and every move after that is written as the distance from the one before.
+void StartFragment(GcodeEmitter *builder, const GcodeEmitter *settings, GcodeSink sink)
+{
+    memset(builder, 0, sizeof(*builder));
+    builder->sink = sink;
+    builder->compact = settings->compact;
+    builder->optimize = settings->optimize;
+    builder->joinDistance = settings->joinDistance;
+    builder->quantize = settings->quantize;
+    builder->decimals = settings->decimals;
+    builder->stepUnits = settings->stepUnits;
+    builder->unitsPerMm = settings->unitsPerMm;
+    builder->relative = 1;
+    builder->motion = -1;
+    builder->pen = 0;
+    builder->havePosition = 1;                              // lastX = lastY = 0: the origin
+}
+
+// Function: sends a fragment made with StartFragment from the current position, which must be its origin
+// Its lines are passed on as they are, without formatting anything again. Afterwards the emitter knows where
+// the fragment left the pen, and that the controller is in G91 until the next coordinate line switches back.
+void EmitFragment(GcodeEmitter *emitter, const GcodeFragment *fragment)
+{
+    FlushPending(emitter);
+
+    const char *line = fragment->text;
+    for (int lineIdx = 0; lineIdx < fragment->nLines; lineIdx++)
+    {
+        size_t length = strlen(line);
+        emitter->sink((char *)line);                        // Sinks copy the line, the cached text stays unchanged
+        line += length + 1;                                 // Next line after the terminating zero
+    }
+
+    emitter->lines += (unsigned long)fragment->nLines;
+    emitter->bytes += fragment->bytes;
+    emitter->fullBytes += fragment->fullBytes;
+    emitter->lastX += fragment->moveX;
+    emitter->lastY += fragment->moveY;
+    emitter->motion = fragment->motion;
+    emitter->pen = fragment->pen;
+    if (fragment->incremental)
+    {
+        emitter->incremental = 1;
+    }
+}
+
+// Function: sends everything held back by the peephole pass, without adding a line of its own
+void FlushGcodeEmitter(GcodeEmitter *emitter)
+{
+    FlushPending(emitter);
+}
+
+// Function: counts a G1 that an arc replaced towards the full line byte count of the bytes saved report
+void CountReplacedMove(GcodeEmitter *emitter, float x, float y)
+{
+    emitter->fullBytes += FullMoveLength(x, y);
+}
+
+// Function: prepares an emitter
+// Inputs: sink (receives each line), compact (leave out modal repeats), optimize (peephole pass over travels
+//         and pen commands), joinDistance (longest pen-up gap in mm drawn through with optimize, 0 for none),
+//         step (coordinate grid in mm, 0 for the usual 0.001 mm without any rounding beyond printf's)
+// Returns: 0 when successful, -1 if step is not a multiple of 0.000001 mm
+int InitGcodeEmitter(GcodeEmitter *emitter, GcodeSink sink, int compact, int optimize, float joinDistance, float step)
+{
+    memset(emitter, 0, sizeof(*emitter));
+    emitter->sink = sink;
+    emitter->compact = compact;
+    emitter->optimize = optimize;
+    emitter->joinDistance = joinDistance;
+    emitter->motion = -1;
+    emitter->pen = -1;
+
+    if (step <= 0.0f)
+    {
+        emitter->decimals = FULL_DECIMALS;                  // No extra rounding: same digits as the full format
+        emitter->stepUnits = 1;
+        emitter->unitsPerMm = 1000.0;
+        return 0;
+    }
+
+    double scale = 1.0;
+    for (int decimals = 0; decimals <= GCODE_MAX_DECIMALS; decimals++, scale *= 10.0)
+    {
+        double units = (double)step * scale;                // The step in units of 10^-decimals mm
+        if (fabs(units - floor(units + 0.5)) < 1e-3 * units)
+        {
+            emitter->decimals = decimals;                   // Fewest decimals that show every grid point exactly
+            emitter->stepUnits = (long long)floor(units + 0.5);
+            emitter->unitsPerMm = scale / (double)emitter->stepUnits;
+            emitter->quantize = 1;
+            return 0;
+        }
+    }
+    return -1;
+}
+
+// Function: sends a fixed line such as the setup commands
+// Held back commands go first. The emitter cannot tell what the line changes, so it assumes nothing about
+// the controller afterwards.
+void EmitGcode(GcodeEmitter *emitter, const char *text)
+{
+    FlushPending(emitter);
+
+    size_t length = strlen(text);
+    if (length >= GCODE_LINE_MAX) length = GCODE_LINE_MAX - 1;
+
+    memcpy(emitter->line, text, length);
+    emitter->line[length] = 0;
+    emitter->fullBytes += length;
+    emitter->motion = -1;
+    emitter->pen = -1;
+    emitter->havePosition = 0;
+    SendLine(emitter, emitter->line + length);
+}
+
+// Function: raises (S0) or lowers (S1000) the pen
+// In compact mode nothing is sent when the pen is already in that state. With optimize a lift is held back:
+// if the pen is lowered again before it has travelled anywhere, or after a travel no longer than joinDistance,
+// neither command is sent; a short travel is then drawn as a G1 with the pen still down.
+void EmitPen(GcodeEmitter *emitter, int down)
+{
+    emitter->fullBytes += down ? 6 : 3;
+
+    if (emitter->optimize)
+    {
+        if (!down)
+        {
+            if (emitter->pendingLift || emitter->pen == 0)
+                emitter->penDropped++;                      // Already up, or going up
+            else
+                emitter->pendingLift = 1;                   // Sent with the next travel that goes somewhere
+            return;
+        }
+
+        if (emitter->pendingLift && emitter->pendingTravel && IsShortGap(emitter) &&
+            !IsAtPosition(emitter, emitter->travelX, emitter->travelY))   // A travel that goes nowhere is dropped below
+        {
+            emitter->pendingTravel = 0;
+            emitter->pendingLift = 0;
+            emitter->penDropped += 2;                       // The lift and this lower
+            emitter->togglesRemoved++;
+            emitter->gapsJoined++;
+            SendMove(emitter, 1, emitter->travelX, emitter->travelY);   // Draw across the gap
+            return;
+        }
+
+        FlushTravel(emitter);
+        if (emitter->pendingLift)                           // Still at the place where the pen came up
+        {
+            emitter->pendingLift = 0;
+            emitter->penDropped += 2;                       // The lift and this lower
+            emitter->togglesRemoved++;
+            return;
+        }
+    }
+
+    if ((emitter->compact || emitter->optimize) && emitter->pen == down)
+    {
+        emitter->penDropped++;
+        return;
+    }
+    SendPen(emitter, down);
+}
+
+// Function: moves to x, y with the pen drawing (G1) or travelling (G0)
+// In compact, optimize or relative mode a move to the current position is dropped. With optimize a travel is held back
+// until the next command, so a later travel replaces it instead of following it.
+void EmitMove(GcodeEmitter *emitter, int draw, float x, float y)
+{
+    emitter->fullBytes += FullMoveLength(x, y);
+
+    if (emitter->optimize)
+    {
+        if (!draw)
+        {
+            if (emitter->pendingTravel)
+                emitter->movesDropped++;                    // Only the last of several travels matters
+            emitter->pendingTravel = 1;
+            emitter->travelX = x;
+            emitter->travelY = y;
+            return;
+        }
+        FlushPending(emitter);
+    }
+
+    if ((emitter->compact || emitter->optimize || emitter->relative) && IsAtPosition(emitter, x, y))
+    {
+        emitter->movesDropped++;                            // Already there
+        return;
+    }
+    SendMove(emitter, draw, x, y);
+}
+
+// Function: prints the size of the job and what compaction and the peephole pass saved against full lines at 3 decimals
+void ReportGcodeStats(const GcodeEmitter *emitter)
+{
+    unsigned long long saved = (emitter->fullBytes > emitter->bytes) ? emitter->fullBytes - emitter->bytes : 0;
+
+    printf("G-code: %lu lines, %llu bytes, %llu bytes saved (%.1f%% of %llu)\n",
+           emitter->lines, emitter->bytes, saved,
+           emitter->fullBytes ? 100.0 * (double)saved / (double)emitter->fullBytes : 0.0, emitter->fullBytes);
+    if (emitter->movesDropped || emitter->penDropped)
+    {
+        printf("        %lu moves and %lu pen commands left out\n", emitter->movesDropped, emitter->penDropped);
+    }
+    if (emitter->optimize)
+    {
+        printf("Pen toggles removed: %lu (%lu where strokes meet, %lu gaps of at most %.2f mm drawn through)\n",
+               emitter->togglesRemoved, emitter->togglesRemoved - emitter->gapsJoined, emitter->gapsJoined,
+               emitter->joinDistance);
+    }
+}
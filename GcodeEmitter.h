@@ -0,0 +1,74 @@
+#ifndef GCODEEMITTER_H_INCLUDED
+#define GCODEEMITTER_H_INCLUDED
+
+
+#define GCODE_LINE_MAX 100             /* Longest line the emitter writes, including the terminating zero */
+
+// Receives every finished line, e.g. SendCommands
+typedef void (*GcodeSink)(char *line);
+
+// Turns pen and move requests into G-code lines
+// In compact mode it keeps track of what the controller already knows (modal group state) and leaves out
+// whatever would repeat it: the G0/G1 word when the motion mode is unchanged, an axis whose coordinate is
+// unchanged, moves that go nowhere, pen commands for the pen's current state, spaces and redundant zeros.
+// Coordinates are rounded to a grid of 'step' mm, which also decides the number of decimals.
+// With optimize set it also holds back each travel and pen lift until the next command shows whether they are
+// needed: travels in a row become one, a travel that goes nowhere is dropped, and a lift followed by a lower at
+// the same place is dropped together with the lower. With joinDistance > 0 the pen also stays down for a travel
+// of at most that length between two strokes, and draws straight across the gap instead.
+typedef struct {
+    GcodeSink sink;                    // Where lines go
+    int compact;                       // 0 = full "G1 X1.000 Y2.000" lines as always, 1 = leave out modal repeats
+    int optimize;                      // Peephole pass over travels and pen commands
+    float joinDistance;                // mm; shorter pen-up gaps are drawn through (optimize), 0 to keep every gap
+    int quantize;                      // Coordinates are rounded to the step grid (a step was given)
+    int decimals;                      // Digits written after the decimal point
+    long long stepUnits;               // Quantization step in units of 10^-decimals mm
+    double unitsPerMm;                 // Steps per mm (1 / step)
+
+    int relative;                      // Coordinates are written as distances from the previous position (G91 fragment)
+    int incremental;                   // The controller is in G91; the next coordinate line must say which mode it wants
+    int motion;                        // Motion mode the controller is in: 0 to 3 (G0 to G3), or -1 when not known
+    int pen;                           // Pen state the controller is in: 0 up, 1 down, -1 not known
+    int havePosition;                  // lastX/lastY hold the controller's position
+    long long lastX, lastY;            // Position of the last move, in steps
+
+    int pendingTravel;                 // A travel to travelX, travelY is held back (optimize)
+    float travelX, travelY;            // Target of the held back travel
+    int pendingLift;                   // A pen lift is held back (optimize)
+
+    unsigned long lines;               // Lines sent
+    unsigned long long bytes;          // Bytes sent
+    unsigned long long fullBytes;      // Bytes the same job takes as full lines at 3 decimals
+    unsigned long movesDropped;        // Moves left out: zero length, or merged into a later travel
+    unsigned long penDropped;          // Pen commands left out because they changed nothing
+    unsigned long togglesRemoved;      // Lift and lower pairs left out, including joined gaps
+    unsigned long gapsJoined;          // Short gaps drawn through with the pen down
+    char line[GCODE_LINE_MAX];         // Line being built
+} GcodeEmitter;
+
+// Pre-formatted G91 lines, e.g. one glyph at one size, sent again and again without formatting
+typedef struct {
+    char *text;                        // The lines, each one followed by a terminating zero
+    size_t size;                       // Bytes of text, terminating zeros included
+    int nLines;                        // Lines in text
+    unsigned long long bytes;          // Bytes the lines send (no terminating zeros)
+    unsigned long long fullBytes;      // Full line bytes of the same moves, measured from the fragment's origin
+    long long moveX, moveY;            // Where the fragment leaves the pen, in steps from its origin
+    int motion;                        // Motion mode after the fragment
+    int pen;                           // Pen state after the fragment
+    int incremental;                   // 1 if the fragment switches the controller to G91
+} GcodeFragment;
+
+int  InitGcodeEmitter(GcodeEmitter *emitter, GcodeSink sink, int compact, int optimize, float joinDistance, float step); // step in mm, 0 for 0.001 mm; -1 if step is unusable
+void EmitGcode(GcodeEmitter *emitter, const char *text);            // Send held back commands, then a fixed line, e.g. setup; modal state becomes unknown
+void EmitPen(GcodeEmitter *emitter, int down);                      // S1000 (down) or S0 (up)
+void EmitMove(GcodeEmitter *emitter, int draw, float x, float y);   // G1 (draw) or G0 (travel) to x, y
+int  EmitArc(GcodeEmitter *emitter, int counterClockwise, float x, float y, float centreX, float centreY); // G3 or G2 to x, y; -1 if not sent
+void CountReplacedMove(GcodeEmitter *emitter, float x, float y);    // Count a G1 an arc replaced, for the bytes saved report
+void StartFragment(GcodeEmitter *builder, const GcodeEmitter *settings, GcodeSink sink); // Emit a G91 fragment from (0,0) with settings' format
+void EmitFragment(GcodeEmitter *emitter, const GcodeFragment *fragment);   // Send a fragment whose origin is the current position
+void FlushGcodeEmitter(GcodeEmitter *emitter);                      // Send what the peephole pass holds back
+void ReportGcodeStats(const GcodeEmitter *emitter);                 // Print lines, bytes, bytes saved and commands left out
+
+#endif // GCODEEMITTER_H_INCLUDED
@@ -0,0 +1,82 @@
+#include <stdio.h>
+#include <math.h>
+
+#include "GcodeFormat.h"
+
+static const double powersOfTen[GCODE_MAX_DECIMALS + 1] = {1.0, 10.0, 100.0, 1000.0, 10000.0, 100000.0, 1000000.0};
+
+// Helper function: writes units * 10^-decimals, the sign already decided by the caller
+static char *WriteUnits(char *out, unsigned long long units, int negative, int decimals, int trimZeros)
+{
+    char digits[24];
+    int nDigits = 0;
+
+    if (trimZeros)
+    {
+        while (decimals > 0 && units % 10 == 0)          // Drop trailing zeros of the fraction
+        {
+            units /= 10;
+            decimals--;
+        }
+        if (units == 0) negative = 0;                    // No "-0"
+    }
+
+    if (negative)
+    {
+        *out++ = '-';
+    }
+
+    do                                                   // Digits from the least significant end, at least one before the point
+    {
+        digits[nDigits++] = (char)('0' + units % 10);
+        units /= 10;
+    }
+    while (units != 0 || nDigits <= decimals);
+
+    while (nDigits > decimals)                           // Integer part
+    {
+        *out++ = digits[--nDigits];
+    }
+    if (decimals > 0)
+    {
+        *out++ = '.';
+        while (nDigits > 0)                              // Fraction, leading zeros included
+        {
+            *out++ = digits[--nDigits];
+        }
+    }
+
+    *out = 0;
+    return out;
+}
+
+// Function: formats one coordinate without printf
+// A float has a 24 bit mantissa and 10^6 needs 20 bits, so value * 10^decimals is exact in a double and
+// rounding it to the nearest integer (ties to even, the default rounding mode) gives the same digits as
+// printf's correctly rounded conversion. Only the integer digits are then written out.
+// Inputs: out (at least GCODE_NUMBER_MAX bytes), value, decimals (0 to GCODE_MAX_DECIMALS), trimZeros
+// Returns: pointer to the terminating zero written after the number
+char *FormatCoordinate(char *out, float value, int decimals, int trimZeros)
+{
+    if (decimals < 0) decimals = 0;
+    if (decimals > GCODE_MAX_DECIMALS) decimals = GCODE_MAX_DECIMALS;
+
+    double scaled = fabs((double)value) * powersOfTen[decimals];
+    if (!(scaled < 9.0e18))                              // Infinity, NaN or too large for the integer path (never a plotter coordinate)
+    {
+        return out + sprintf(out, "%.*f", decimals, value);
+    }
+
+    // printf keeps the sign of -0.0 and of values that round to zero
+    return WriteUnits(out, (unsigned long long)llrint(scaled), signbit(value) != 0, decimals, trimZeros);
+}
+
+// Function: formats a number already counted in steps of 10^-decimals, e.g. a quantized coordinate
+// Inputs: out (at least GCODE_NUMBER_MAX bytes), units, decimals (0 to GCODE_MAX_DECIMALS), trimZeros
+// Returns: pointer to the terminating zero written after the number
+char *FormatFixedPoint(char *out, long long units, int decimals, int trimZeros)
+{
+    unsigned long long magnitude = (units < 0) ? 0ULL - (unsigned long long)units : (unsigned long long)units;
+
+    return WriteUnits(out, magnitude, units < 0, decimals, trimZeros);
+}
@@ -0,0 +1,17 @@
+#ifndef GCODEFORMAT_H_INCLUDED
+#define GCODEFORMAT_H_INCLUDED
+
+
+#define GCODE_MAX_DECIMALS 6           /* Most decimals FormatCoordinate rounds exactly (float * 10^6 fits a double) */
+#define GCODE_NUMBER_MAX   32          /* Longest text FormatCoordinate can write, with its terminating zero */
+
+// Writes value as a fixed-point decimal number with 'decimals' digits after the point, followed by a zero byte
+// With trimZeros == 0 the text is the same as printf("%.*f", decimals, value); otherwise trailing zeros,
+// a bare decimal point and the sign of a value that rounds to zero are left out ("1.5", "2", "0")
+// Returns: pointer to the terminating zero, so further text can be appended straight after the number
+char *FormatCoordinate(char *out, float value, int decimals, int trimZeros);
+
+// Writes units * 10^-decimals the same way, for numbers that are already integers of a fixed step
+char *FormatFixedPoint(char *out, long long units, int decimals, int trimZeros);
+
+#endif // GCODEFORMAT_H_INCLUDED
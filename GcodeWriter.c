@@ -0,0 +1,79 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "GcodeWriter.h"
+
+// Helper function: writes the buffered bytes to the file
+static void FlushGcodeWriter(GcodeWriter *writer)
+{
+    if (writer->used > 0 && !writer->failed)
+    {
+        if (fwrite(writer->buffer, 1, writer->used, writer->file) != writer->used)
+        {
+            writer->failed = 1;                  // Disk full or similar, reported by CloseGcodeWriter
+        }
+    }
+    writer->used = 0;
+}
+
+// Function: creates the output file and its buffer
+// stdio's own buffering is turned off, whole buffers go straight to the file
+// Returns: 0 when successful, -1 if the file could not be created or memory allocated
+int OpenGcodeWriter(const char *path, GcodeWriter *writer)
+{
+    memset(writer, 0, sizeof(*writer));
+
+    writer->buffer = malloc(GCODE_WRITER_BUFFER);
+    if (writer->buffer == NULL)
+    {
+        return -1;
+    }
+
+    writer->file = fopen(path, "wb");            // Binary, so lines end in '\n' on every system like on the serial link
+    if (writer->file == NULL)
+    {
+        free(writer->buffer);
+        writer->buffer = NULL;
+        return -1;
+    }
+    setvbuf(writer->file, NULL, _IONBF, 0);
+    return 0;
+}
+
+// Function: appends text (complete G-code lines) to the output buffer, writing the buffer out when full
+void WriteGcode(GcodeWriter *writer, const char *text, size_t length)
+{
+    for (const char *end = text + length, *p = text; (p = memchr(p, '\n', end - p)) != NULL; p++)
+    {
+        writer->lines++;                         // Count the lines for the job summary
+    }
+    writer->bytes += length;
+
+    if (writer->used + length > GCODE_WRITER_BUFFER)
+    {
+        FlushGcodeWriter(writer);
+        if (length > GCODE_WRITER_BUFFER)        // Larger than the whole buffer: write it directly
+        {
+            if (!writer->failed && fwrite(text, 1, length, writer->file) != length) writer->failed = 1;
+            return;
+        }
+    }
+
+    memcpy(writer->buffer + writer->used, text, length);
+    writer->used += length;
+}
+
+// Function: writes out the rest of the buffer and closes the file
+// Returns: 0 when every byte reached the file, -1 after any write or close error
+int CloseGcodeWriter(GcodeWriter *writer)
+{
+    FlushGcodeWriter(writer);
+    if (fclose(writer->file) != 0)
+    {
+        writer->failed = 1;
+    }
+    free(writer->buffer);
+    writer->file = NULL;
+    writer->buffer = NULL;
+    return writer->failed ? -1 : 0;
+}
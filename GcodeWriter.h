@@ -0,0 +1,26 @@
+#include <stdio.h>
+#include <stddef.h>
+
+
+#ifndef GCODEWRITER_H_INCLUDED
+#define GCODEWRITER_H_INCLUDED
+
+
+#define GCODE_WRITER_BUFFER (1024 * 1024)  /* Bytes collected before each write to the file */
+
+// G-code output file for offline jobs
+// Lines are copied into one large buffer and written out in big blocks, so a whole page costs a few system calls
+typedef struct {
+    FILE *file;                        // Output .gcode file
+    char *buffer;                      // GCODE_WRITER_BUFFER bytes waiting to be written
+    size_t used;                       // Bytes in buffer
+    unsigned long lines;               // Lines written so far
+    unsigned long long bytes;          // Bytes written so far
+    int failed;                        // Set after a write error, later lines are dropped
+} GcodeWriter;
+
+int  OpenGcodeWriter(const char *path, GcodeWriter *writer);           // Create the file, returns 0 on success, -1 on failure
+void WriteGcode(GcodeWriter *writer, const char *text, size_t length); // Append one or more complete lines
+int  CloseGcodeWriter(GcodeWriter *writer);                            // Write what is left and close, returns 0 if every byte was written
+
+#endif // GCODEWRITER_H_INCLUDED
@@ -0,0 +1,219 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "GlyphCache.h"
+#include "StrokeBuffer.h"
+
+// Function prototype: the same conversion the word-by-word path uses, here run once per glyph
+void ConvertStrokestoGcode(const StrokeBuffer *strokes, GcodeEmitter *emitter, float arcTolerance);
+
+static GcodeFragment *building;          // Fragment the builder's lines are appended to
+static size_t buildCapacity;             // Bytes allocated for building->text
+static int buildFailed;                  // Set when the text could not grow
+
+// Helper function: sink of the fragment builder, appends one line and its terminating zero
+static void AppendFragmentLine(char *line)
+{
+    size_t length = strlen(line) + 1;
+
+    if (buildFailed) return;
+    if (building->size + length > buildCapacity)
+    {
+        size_t capacity = buildCapacity ? 2 * buildCapacity : 256;
+        while (capacity < building->size + length) capacity *= 2;
+
+        char *grown = realloc(building->text, capacity);
+        if (grown == NULL)
+        {
+            buildFailed = 1;
+            return;
+        }
+        building->text = grown;
+        buildCapacity = capacity;
+    }
+
+    memcpy(building->text + building->size, line, length);
+    building->size += length;
+    building->nLines++;
+}
+
+// Helper function: formats one glyph at the instance's scale into a G91 fragment
+// The glyph is transformed so that its first point lands on (0,0), simplified and arc-fitted like a word,
+// and converted by ConvertStrokestoGcode with a relative emitter. Pen-up points after the last stroke only
+// lead to the next glyph, which starts with its own absolute G0, so they are left out.
+// Returns: 0 when successful, -1 if memory ran out
+static int BuildFragment(GlyphCache *cache, GlyphFragment *slot, const GlyphInstance *instance,
+                         StrokeArena *arena, const GcodeEmitter *settings)
+{
+    const GlyphData *glyph = instance->glyph;
+
+    slot->empty = 1;
+    slot->points = 0;
+    slot->pointsRemoved = 0;
+    memset(&slot->gcode, 0, sizeof(slot->gcode));
+    if (glyph->nMoves == 0)
+    {
+        return 0;
+    }
+
+    slot->originX = ((float)STROKE_POINT_X(glyph->points[0]) - glyph->minX) * instance->scale;
+    slot->originY = (float)STROKE_POINT_Y(glyph->points[0]) * instance->scale;
+
+    GlyphInstance local = *instance;             // Same glyph and scale, placed so its first point is the origin
+    local.x = -slot->originX;
+    local.y = -slot->originY;
+
+    StrokeBuffer strokes;
+    if (TransformStrokes(&local, 1, arena, &strokes) < 0)
+    {
+        return -1;
+    }
+    slot->points = strokes.nPoints;
+    if (cache->simplifyTolerance > 0.0f)
+    {
+        int removed = SimplifyStrokes(&strokes, cache->simplifyTolerance, arena);
+        if (removed > 0) slot->pointsRemoved = removed;   // Out of memory: the glyph stays unsimplified
+    }
+    while (strokes.nPoints > 0 && strokes.Z[strokes.nPoints - 1] == 0)
+    {
+        strokes.nPoints--;                       // Trailing travel towards the next glyph
+    }
+    if (strokes.nPoints == 0)
+    {
+        return 0;                                // Nothing is drawn
+    }
+
+    GcodeEmitter builder;
+    StartFragment(&builder, settings, AppendFragmentLine);
+    building = &slot->gcode;
+    buildCapacity = 0;
+    buildFailed = 0;
+
+    ConvertStrokestoGcode(&strokes, &builder, cache->arcTolerance);
+    FlushGcodeEmitter(&builder);                 // The final lift may still be held back by the peephole pass
+    building = NULL;
+
+    if (buildFailed)
+    {
+        free(slot->gcode.text);
+        memset(&slot->gcode, 0, sizeof(slot->gcode));
+        return -1;
+    }
+
+    slot->gcode.bytes = builder.bytes;
+    slot->gcode.fullBytes = builder.fullBytes;
+    slot->gcode.moveX = builder.lastX;
+    slot->gcode.moveY = builder.lastY;
+    slot->gcode.motion = builder.motion;
+    slot->gcode.pen = builder.pen;
+    slot->gcode.incremental = builder.incremental;
+    slot->empty = (slot->gcode.nLines == 0);
+    return 0;
+}
+
+// Helper function: finds the fragment of a glyph instance, formatting it on first use
+// The key is (ascii, scale, precision); the scale follows from the font size. A full table replaces the
+// fragment in the key's home slot, so the cache never stops working, it only formats that glyph again.
+// Returns: the fragment, NULL if memory ran out
+static GlyphFragment *FindFragment(GlyphCache *cache, const GlyphInstance *instance, StrokeArena *arena,
+                                   const GcodeEmitter *settings)
+{
+    unsigned int scaleBits;
+    memcpy(&scaleBits, &instance->scale, sizeof(scaleBits));
+
+    unsigned int hash = (unsigned int)instance->ascii * 2654435761u;
+    hash ^= scaleBits * 40503u;
+    hash ^= (unsigned int)settings->stepUnits * 97u + (unsigned int)settings->decimals;
+    unsigned int home = hash & (GLYPH_CACHE_SLOTS - 1);
+
+    GlyphFragment *slot = NULL;
+    for (unsigned int probe = 0; probe < GLYPH_CACHE_SLOTS; probe++)
+    {
+        GlyphFragment *candidate = &cache->slots[(home + probe) & (GLYPH_CACHE_SLOTS - 1)];
+        if (!candidate->used)
+        {
+            slot = candidate;                    // Not cached yet
+            break;
+        }
+        if (candidate->ascii == instance->ascii && candidate->scale == instance->scale &&
+            candidate->stepUnits == settings->stepUnits && candidate->decimals == settings->decimals)
+        {
+            cache->hits++;
+            return candidate;
+        }
+    }
+
+    if (slot == NULL)                            // Every slot is taken
+    {
+        slot = &cache->slots[home];
+        free(slot->gcode.text);
+    }
+
+    slot->used = 0;
+    if (BuildFragment(cache, slot, instance, arena, settings) != 0)
+    {
+        return NULL;
+    }
+    cache->built++;
+    slot->used = 1;
+    slot->ascii = instance->ascii;
+    slot->scale = instance->scale;
+    slot->stepUnits = settings->stepUnits;
+    slot->decimals = settings->decimals;
+    return slot;
+}
+
+// Function: prepares an empty glyph cache; the tolerances are those of the job (-t and -a)
+void InitGlyphCache(GlyphCache *cache, float simplifyTolerance, float arcTolerance)
+{
+    memset(cache, 0, sizeof(*cache));
+    cache->simplifyTolerance = simplifyTolerance;
+    cache->arcTolerance = arcTolerance;
+}
+
+// Function: draws the placed characters of one word from their cached G91 fragments
+// For every character the emitter travels (G0, absolute) to the glyph's first point and then sends the
+// fragment as it is: no transform, no formatting. A glyph seen for the first time is formatted once.
+// Inputs: cache, placed characters, count, arena for formatting new glyphs, emitter of the job
+// Returns: 0 when successful, -1 if memory ran out
+int DrawWordCached(GlyphCache *cache, const GlyphInstance *chars, int nChars, StrokeArena *arena, GcodeEmitter *emitter)
+{
+    for (int charIdx = 0; charIdx < nChars; charIdx++)
+    {
+        const GlyphInstance *instance = &chars[charIdx];
+        GlyphFragment *fragment = FindFragment(cache, instance, arena, emitter);
+        if (fragment == NULL)
+        {
+            return -1;
+        }
+        cache->pointsTotal += (unsigned long)fragment->points;      // Counted per character, like the words of the normal path
+        cache->pointsRemoved += (unsigned long)fragment->pointsRemoved;
+        if (fragment->empty)
+        {
+            continue;
+        }
+
+        EmitMove(emitter, 0, instance->x + fragment->originX, instance->y + fragment->originY);
+        EmitFragment(emitter, &fragment->gcode);
+    }
+    return 0;
+}
+
+// Function: prints how many characters came from the cache
+void ReportGlyphCache(const GlyphCache *cache)
+{
+    printf("Glyph cache: %lu characters sent from %lu fragments formatted once\n",
+           cache->hits + cache->built, cache->built);
+}
+
+// Memory cleanup function: frees the text of every cached fragment
+void FreeGlyphCache(GlyphCache *cache)
+{
+    for (int slotIdx = 0; slotIdx < GLYPH_CACHE_SLOTS; slotIdx++)
+    {
+        free(cache->slots[slotIdx].gcode.text);
+        cache->slots[slotIdx].gcode.text = NULL;
+        cache->slots[slotIdx].used = 0;
+    }
+}
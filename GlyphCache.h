@@ -0,0 +1,43 @@
+#include "StrokeFont.h"
+#include "StrokeArena.h"
+#include "GcodeEmitter.h"
+
+
+#ifndef GLYPHCACHE_H_INCLUDED
+#define GLYPHCACHE_H_INCLUDED
+
+
+#define GLYPH_CACHE_SLOTS 1024           /* Fragments kept; a power of two, room for every glyph at four sizes */
+
+// One glyph rendered at one size and precision: its G91 fragment plus where it starts
+typedef struct {
+    int   used;                  // Slot holds a fragment
+    int   ascii;                 // Key: character
+    float scale;                 // Key: millimetres per font unit (the font size / 18)
+    long long stepUnits;         // Key: coordinate precision of the emitter the fragment was made for
+    int   decimals;
+    float originX, originY;      // The glyph's first point relative to its placement (mm); the fragment starts there
+    int   empty;                 // The glyph never puts the pen down, nothing is sent for it
+    int   points;                // Stroke points of the glyph before -t simplification
+    int   pointsRemoved;         // Points -t left out
+    GcodeFragment gcode;         // The pre-formatted lines
+} GlyphFragment;
+
+// Fragments of every glyph drawn so far, found by hashing the key and probing the following slots
+typedef struct {
+    GlyphFragment slots[GLYPH_CACHE_SLOTS];
+    float simplifyTolerance;     // -t applied to each glyph before it is formatted, 0 for none
+    float arcTolerance;          // -a applied to each glyph, 0 for none
+    unsigned long hits;          // Characters drawn from a cached fragment
+    unsigned long built;         // Fragments formatted
+    unsigned long pointsTotal;   // Stroke points of every character drawn, before -t simplification
+    unsigned long pointsRemoved; // Points -t left out of them
+} GlyphCache;
+
+void InitGlyphCache(GlyphCache *cache, float simplifyTolerance, float arcTolerance);
+// Draw placed characters: an absolute G0 to each glyph's first point, then its cached G91 fragment
+int  DrawWordCached(GlyphCache *cache, const GlyphInstance *chars, int nChars, StrokeArena *arena, GcodeEmitter *emitter);
+void ReportGlyphCache(const GlyphCache *cache);
+void FreeGlyphCache(GlyphCache *cache);
+
+#endif // GLYPHCACHE_H_INCLUDED
@@ -0,0 +1,126 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "GrblResponse.h"
+
+#define RING_MASK (GRBL_RESPONSE_RING_SIZE - 1)
+#define IS_LINE_END(c) (((c) == '\n') || ((c) == '\r'))
+
+// Helper function: works out what kind of reply a complete line is
+// Reply codes are read from "error:N" and "ALARM:N" (GRBL 1.1), older firmware sends text after the colon instead
+static void ClassifyReply(GrblReply *reply)
+{
+    const char *text = reply->text;
+
+    reply->code = -1;
+
+    if (strncmp(text, "ok", 2) == 0)
+    {
+        reply->type = GRBL_REPLY_OK;
+    }
+    else if (strncmp(text, "error", 5) == 0)
+    {
+        reply->type = GRBL_REPLY_ERROR;
+        if (text[5] == ':' && text[6] >= '0' && text[6] <= '9') reply->code = atoi(text + 6);
+    }
+    else if (strncmp(text, "ALARM", 5) == 0)
+    {
+        reply->type = GRBL_REPLY_ALARM;
+        if (text[5] == ':' && text[6] >= '0' && text[6] <= '9') reply->code = atoi(text + 6);
+    }
+    else if (text[0] == '<')
+    {
+        reply->type = GRBL_REPLY_STATUS;
+    }
+    else if (text[0] == '[')
+    {
+        reply->type = GRBL_REPLY_OTHER;     // Messages such as "[MSG:'$H'|'$X' to unlock]" after an alarm
+    }
+    else if (strncmp(text, "Grbl", 4) == 0)
+    {
+        reply->type = GRBL_REPLY_BANNER;
+    }
+    else
+    {
+        reply->type = GRBL_REPLY_OTHER;
+    }
+}
+
+// Function: empties the receive ring
+void GrblResponseInit(GrblResponse *response)
+{
+    response->head = 0;
+    response->tail = 0;
+    response->scanned = 0;
+    response->overflow = 0;
+    response->line[0] = 0;
+}
+
+// Function: appends bytes read from the port to the ring
+// Complete lines should be taken out with GrblResponseNext before feeding more, then only the
+// unfinished last line is held. If that line alone fills the ring it is dropped up to its line ending.
+void GrblResponseFeed(GrblResponse *response, const unsigned char *bytes, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        unsigned char c = bytes[i];
+
+        if (response->overflow)
+        {
+            if (IS_LINE_END(c)) response->overflow = 0;    // The oversized line has ended
+            continue;
+        }
+
+        if (response->head - response->tail == GRBL_RESPONSE_RING_SIZE)
+        {
+            response->tail = response->head;                // Drop the line that filled the ring
+            response->scanned = response->head;
+            response->overflow = !IS_LINE_END(c);
+            continue;
+        }
+
+        response->data[response->head & RING_MASK] = (char)c;
+        response->head++;
+    }
+}
+
+// Function: takes the next complete line out of the ring and classifies it
+// Empty lines (the "\r\n" pairs GRBL ends every reply with) are skipped
+// Returns: 1 with reply filled in, 0 if no complete line has been received yet
+int GrblResponseNext(GrblResponse *response, GrblReply *reply)
+{
+    while (response->tail != response->head && IS_LINE_END(response->data[response->tail & RING_MASK]))
+    {
+        response->tail++;                                   // Skip line endings left over from the previous line
+    }
+    if ((int)(response->scanned - response->tail) < 0)
+    {
+        response->scanned = response->tail;
+    }
+
+    while (response->scanned != response->head && !IS_LINE_END(response->data[response->scanned & RING_MASK]))
+    {
+        response->scanned++;                                // Bytes already checked are not looked at again on the next call
+    }
+    if (response->scanned == response->head)
+    {
+        return 0;                                           // The line is still arriving
+    }
+
+    int length = (int)(response->scanned - response->tail);
+    if (length > GRBL_RESPONSE_LINE_MAX) length = GRBL_RESPONSE_LINE_MAX;
+
+    for (int i = 0; i < length; i++)                        // Copy out, the line may wrap around the end of the ring
+    {
+        response->line[i] = response->data[(response->tail + i) & RING_MASK];
+    }
+    response->line[length] = 0;
+
+    response->tail = response->scanned + 1;                 // Consume the line and its line ending
+    response->scanned = response->tail;
+
+    reply->text = response->line;
+    reply->length = length;
+    ClassifyReply(reply);
+    return 1;
+}
@@ -0,0 +1,45 @@
+#include <stddef.h>
+
+
+#ifndef GRBLRESPONSE_H_INCLUDED
+#define GRBLRESPONSE_H_INCLUDED
+
+
+#define GRBL_RESPONSE_RING_SIZE 1024   /* Bytes of received text held until a full line is in (power of two) */
+#define GRBL_RESPONSE_LINE_MAX  255    /* Longest reply line kept, longer lines are cut short */
+
+// Kind of line the controller sent
+typedef enum {
+    GRBL_REPLY_OK,                     // "ok": one sent line was accepted
+    GRBL_REPLY_ERROR,                  // "error:N": one sent line was rejected
+    GRBL_REPLY_ALARM,                  // "ALARM:N": the controller stopped and locked out motion
+    GRBL_REPLY_STATUS,                 // "<...>": answer to a '?' status query
+    GRBL_REPLY_BANNER,                 // "Grbl 1.1h ['$' for help]": sent on start-up and after every reset
+    GRBL_REPLY_OTHER                   // Anything else ("[MSG:...]", settings, echo)
+} GrblReplyType;
+
+// One complete reply line
+typedef struct {
+    GrblReplyType type;
+    int code;                          // Number after "error:" or "ALARM:", -1 when none was given
+    const char *text;                  // The line without its line ending, valid until the next GrblResponseNext
+    int length;                        // Characters in text
+} GrblReply;
+
+// Received bytes waiting to be split into lines
+// Bytes are fed in whatever chunks the port returns, so one reply can span several reads
+// and one read can hold several replies
+typedef struct {
+    char data[GRBL_RESPONSE_RING_SIZE];    // Ring of received bytes
+    unsigned head;                     // Total bytes fed (write position before masking)
+    unsigned tail;                     // Total bytes consumed (read position before masking)
+    unsigned scanned;                  // Bytes after tail already checked for a line ending
+    int overflow;                      // Set while dropping a line that did not fit in the ring
+    char line[GRBL_RESPONSE_LINE_MAX + 1]; // Current reply line copied out of the ring
+} GrblResponse;
+
+void GrblResponseInit(GrblResponse *response);                                        // Start with no received bytes
+void GrblResponseFeed(GrblResponse *response, const unsigned char *bytes, int count); // Add bytes read from the port
+int  GrblResponseNext(GrblResponse *response, GrblReply *reply);                      // 1 and the next complete line, 0 if none yet
+
+#endif // GRBLRESPONSE_H_INCLUDED
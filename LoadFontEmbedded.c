@@ -0,0 +1,25 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "StrokeFont.h"
+
+// Function: loads the stroke font that was compiled into the program (SingleStrokeFontData.c)
+// Only the glyph table is copied; every glyph still points into read-only data, so there is
+// no parsing, no allocation and no file access
+// Input: destination FontTable
+// Returns: number of glyphs available
+int LoadFontEmbedded(FontTable *font)
+{
+    int nGlyphs = 0;
+
+    memset(font, 0, sizeof(*font));              // Font owns no arrays or mapping, FreeFontTable has nothing to release
+    memcpy(font->glyphs, EmbeddedFontGlyphs, sizeof(font->glyphs));
+
+    for (int asciiValue = 0; asciiValue < FONT_TABLE_SIZE; asciiValue++)
+    {
+        nGlyphs += font->glyphs[asciiValue].defined;
+    }
+    font->nPoints = EmbeddedFontPoints;
+
+    return nGlyphs;
+}
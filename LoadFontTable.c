@@ -0,0 +1,147 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "StrokeFont.h"
+
+// Helper function: makes sure the font's point array can hold at least 'needed' points
+// Grows the array by doubling so that parsing the whole font only reallocates a handful of times
+// Returns: 0 when successful, -1 if memory could not be allocated
+static int ReserveFontPoints(FontTable *font, int needed, int *capacity)
+{
+    if (needed <= *capacity)
+    {
+        return 0;                                // Enough room already
+    }
+
+    int newCapacity = (*capacity > 0) ? *capacity : 1024;   // Start with room for a typical font
+    while (newCapacity < needed)
+    {
+        newCapacity *= 2;                        // Double until the request fits
+    }
+
+    StrokePoint *newPoints = realloc(font->points, (size_t)newCapacity * sizeof(StrokePoint));
+    if (newPoints == NULL) return -1;
+    font->points = newPoints;
+
+    *capacity = newCapacity;
+    return 0;
+}
+
+// Function: parses the whole font file once into an ASCII indexed glyph table
+// Each "999 ascii nMoves" header is followed by nMoves "X Y Z" stroke points, which are packed and
+// appended to one contiguous point array so that a glyph lookup afterwards is a single table index
+// Inputs: open font file pointer, destination FontTable
+// A glyph whose stroke points are cut short by the end of the file is left undefined
+// Returns: number of glyphs loaded when successful, -1 for failure (the table is left empty)
+int LoadFontTable(FILE *fontFile, FontTable *font)
+{
+    int glyphStart[FONT_TABLE_SIZE];             // Index of each glyph's first point while the array may still move
+    int capacity = 0;                            // Number of points the array can currently hold
+    int nGlyphs = 0;                             // Number of glyphs found in the file
+    int X, Y, Z;                                 // One line of the font file
+
+    memset(font, 0, sizeof(*font));              // Start with every glyph undefined and no point array
+
+    if (fontFile == NULL)
+    {
+        return -1;
+    }
+
+    rewind(fontFile);                            // Parse from the start of the file
+
+    while (fscanf(fontFile, "%d %d %d", &X, &Y, &Z) == 3)
+    {
+        if (X != 999)                            // Points outside a glyph block are ignored
+        {
+            continue;
+        }
+
+        int asciiValue = Y;                      // Header: 999 <ascii> <number of stroke points>
+        int moveCount = Z;
+
+        if (moveCount < 0 || ReserveFontPoints(font, font->nPoints + moveCount, &capacity) != 0)
+        {
+            FreeFontTable(font);
+            return -1;                           // Corrupt header or out of memory
+        }
+
+        int moveIndex;
+        for (moveIndex = 0; moveIndex < moveCount; moveIndex++)
+        {
+            if (fscanf(fontFile, "%d %d %d", &X, &Y, &Z) != 3)
+            {
+                break;                           // File ends before the glyph does
+            }
+            if (X < INT16_MIN || X > INT16_MAX || Y < INT16_MIN / 2 || Y > INT16_MAX / 2)
+            {
+                FreeFontTable(font);
+                return -1;                       // Coordinate does not fit the packed point format
+            }
+            StrokePoint point = STROKE_POINT(X, Y, Z);
+            font->points[font->nPoints + moveIndex] = point;
+        }
+        if (moveIndex < moveCount)
+        {
+            break;                               // Truncated glyph stays undefined, the rest of the font is kept
+        }
+
+        // Only the first definition of a character is used, as the old per-character search did
+        if (asciiValue >= 0 && asciiValue < FONT_TABLE_SIZE && !font->glyphs[asciiValue].defined)
+        {
+            font->glyphs[asciiValue].defined = 1;
+            font->glyphs[asciiValue].nMoves = moveCount;
+            glyphStart[asciiValue] = font->nPoints;
+            nGlyphs++;
+        }
+        font->nPoints += moveCount;
+    }
+
+    // The array no longer moves, so the glyph pointers can now be set
+    for (int asciiValue = 0; asciiValue < FONT_TABLE_SIZE; asciiValue++)
+    {
+        if (font->glyphs[asciiValue].defined)
+        {
+            font->glyphs[asciiValue].points = font->points + glyphStart[asciiValue];
+            ComputeGlyphMetrics(&font->glyphs[asciiValue]);
+        }
+    }
+
+    return nGlyphs;
+}
+
+// Function: computes a glyph's bounding box and advance width from its stroke points
+// Done once when the font is loaded, so layout never has to scan the points of a glyph again
+// Input: glyph with its stroke point pointers set
+// No return value
+void ComputeGlyphMetrics(GlyphData *glyph)
+{
+    glyph->minX = glyph->maxX = 0.0f;            // An empty glyph has no extent
+    glyph->minY = glyph->maxY = 0.0f;
+
+    for (int moveIdx = 0; moveIdx < glyph->nMoves; moveIdx++)
+    {
+        float X = (float)STROKE_POINT_X(glyph->points[moveIdx]);
+        float Y = (float)STROKE_POINT_Y(glyph->points[moveIdx]);
+
+        if (moveIdx == 0 || X < glyph->minX) glyph->minX = X;     // Leftmost point, pen-up moves included
+        if (moveIdx == 0 || X > glyph->maxX) glyph->maxX = X;     // Rightmost point
+        if (moveIdx == 0 || Y < glyph->minY) glyph->minY = Y;     // Lowest point (descenders go below 0)
+        if (moveIdx == 0 || Y > glyph->maxY) glyph->maxY = Y;     // Highest point
+    }
+
+    glyph->advance = glyph->maxX - glyph->minX;  // Width of the glyph before letter spacing is added
+}
+
+// Memory cleanup function: releases the point array or file mapping owned by a FontTable and clears the glyph table
+// Input: pointer to FontTable
+// No return value
+void FreeFontTable(FontTable *font)
+{
+    if (font == NULL) return;
+
+    free(font->points);
+    UnmapFile(&font->map);                       // Does nothing for a font parsed from text
+
+    memset(font, 0, sizeof(*font));              // Every glyph is undefined again
+}
@@ -0,0 +1,111 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "MapFile.h"
+
+
+#if defined(__linux__) || defined(__FreeBSD__)   /* Linux & FreeBSD */
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+// Function: maps a whole file read-only into memory
+// The pages are shared with the page cache, so nothing is copied or allocated for the contents
+// Inputs: file path, destination MappedFile
+// Returns: 0 when successful, -1 for failure (missing file, empty file or mmap error)
+int MapFile(const char *path, MappedFile *map)
+{
+    struct stat fileInfo;
+
+    memset(map, 0, sizeof(*map));
+
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+    {
+        return -1;                               // File does not exist or cannot be read
+    }
+
+    if (fstat(fd, &fileInfo) == -1 || fileInfo.st_size <= 0)
+    {
+        close(fd);
+        return -1;                               // Nothing to map
+    }
+
+    void *data = mmap(NULL, (size_t)fileInfo.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);                                   // The mapping stays valid after the descriptor is closed
+    if (data == MAP_FAILED)
+    {
+        return -1;
+    }
+
+    map->data = data;
+    map->size = (size_t)fileInfo.st_size;
+    return 0;
+}
+
+// Function: releases a mapping made by MapFile, safe to call on an empty MappedFile
+void UnmapFile(MappedFile *map)
+{
+    if (map == NULL || map->data == NULL) return;
+
+    munmap((void *)map->data, map->size);
+    memset(map, 0, sizeof(*map));
+}
+
+#else  /* windows */
+
+#include <windows.h>
+
+int MapFile(const char *path, MappedFile *map)
+{
+    LARGE_INTEGER fileSize;
+
+    memset(map, 0, sizeof(*map));
+
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        return -1;
+    }
+
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart <= 0)
+    {
+        CloseHandle(file);
+        return -1;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL)
+    {
+        CloseHandle(file);
+        return -1;
+    }
+
+    void *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (data == NULL)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return -1;
+    }
+
+    map->data = data;
+    map->size = (size_t)fileSize.QuadPart;
+    map->fileHandle = file;
+    map->mappingHandle = mapping;
+    return 0;
+}
+
+void UnmapFile(MappedFile *map)
+{
+    if (map == NULL || map->data == NULL) return;
+
+    UnmapViewOfFile(map->data);
+    CloseHandle((HANDLE)map->mappingHandle);
+    CloseHandle((HANDLE)map->fileHandle);
+    memset(map, 0, sizeof(*map));
+}
+
+#endif
@@ -0,0 +1,21 @@
+#include <stddef.h>
+
+
+#ifndef MAPFILE_H_INCLUDED
+#define MAPFILE_H_INCLUDED
+
+
+// Read-only view of a whole file mapped into memory
+typedef struct {
+    const void *data;        // First byte of the file, NULL when nothing is mapped
+    size_t size;             // Length of the file in bytes
+#if !defined(__linux__) && !defined(__FreeBSD__)
+    void *fileHandle;        // Windows file handle kept open while the view exists
+    void *mappingHandle;     // Windows file mapping object backing the view
+#endif
+} MappedFile;
+
+int  MapFile(const char *path, MappedFile *map);        // Map a file read-only, returns 0 on success, -1 on failure
+void UnmapFile(MappedFile *map);                        // Release a mapping made by MapFile
+
+#endif // MAPFILE_H_INCLUDED
@@ -0,0 +1,460 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "StrokeBuffer.h"
+
+#define ORDER_MAX_CELLS   65536          /* Upper limit on spatial grid cells for the nearest neighbour search */
+#define TWO_OPT_WINDOW    48             /* Polylines looked ahead by each 2-opt step, keeps a pass linear in the line length */
+#define TWO_OPT_PASSES    8              /* 2-opt passes at most; later passes rarely find anything */
+#define TWO_OPT_MIN_GAIN  0.001f         /* mm; smaller improvements are rounding noise */
+
+// One pen-down polyline: a pen-up point followed by its pen-down points, copied in order from the input
+typedef struct {
+    int first;                   // Index of the pen-up start point in the concatenated input
+    int count;                   // Points including the start point
+} Polyline;
+
+// Grid of polyline end points, used to find the nearest end that has not been drawn yet
+typedef struct {
+    float originX, originY;      // Corner of cell 0
+    float cellSize;              // Width and height of one cell in mm
+    int   nx, ny;                // Cells across and down
+    int  *cellStart;             // First entry of each cell
+    int  *cellCount;             // Entries of each cell still in use; drawn polylines are swapped out
+    int  *entries;               // End references: polyline * 2 + 0 for its start, + 1 for its end
+} EndGrid;
+
+// Working arrays of one OrderStrokes call, all taken from the arena
+typedef struct {
+    const float *X, *Y;          // Concatenated input points
+    Polyline *lines;             // Pen-down polylines found in the input
+    int nLines;
+    int *order;                  // Polylines in drawing order
+    unsigned char *flip;         // 1 when order[k] is drawn from its end back to its start
+} OrderWork;
+
+// Helper function: distance between two points in mm
+static float Distance(float x0, float y0, float x1, float y1)
+{
+    float dx = x1 - x0;
+    float dy = y1 - y0;
+    return sqrtf(dx * dx + dy * dy);
+}
+
+// Helper function: pen-up travel of points in the order ConvertStrokestoGcode would draw them, from startX, startY
+static double PenUpTravel(const float *X, const float *Y, const unsigned char *Z, int nPoints, float startX, float startY)
+{
+    double travel = 0.0;
+    float x = startX, y = startY;
+
+    for (int pointIdx = 0; pointIdx < nPoints; pointIdx++)
+    {
+        if (Z[pointIdx] == 0)
+        {
+            travel += Distance(x, y, X[pointIdx], Y[pointIdx]);
+        }
+        x = X[pointIdx];
+        y = Y[pointIdx];
+    }
+    return travel;
+}
+
+// Helper function: first point of polyline k of the drawing order, taking the direction into account
+static void StartOf(const OrderWork *work, int k, float *x, float *y)
+{
+    const Polyline *line = &work->lines[work->order[k]];
+    int idx = work->flip[k] ? line->first + line->count - 1 : line->first;
+    *x = work->X[idx];
+    *y = work->Y[idx];
+}
+
+// Helper function: last point of polyline k of the drawing order
+static void EndOf(const OrderWork *work, int k, float *x, float *y)
+{
+    const Polyline *line = &work->lines[work->order[k]];
+    int idx = work->flip[k] ? line->first : line->first + line->count - 1;
+    *x = work->X[idx];
+    *y = work->Y[idx];
+}
+
+// Helper function: grid cell of a point, clamped to the grid
+static int CellOf(const EndGrid *grid, float x, float y, int *cx, int *cy)
+{
+    int ix = (int)((x - grid->originX) / grid->cellSize);
+    int iy = (int)((y - grid->originY) / grid->cellSize);
+
+    if (ix < 0) ix = 0;
+    if (ix >= grid->nx) ix = grid->nx - 1;
+    if (iy < 0) iy = 0;
+    if (iy >= grid->ny) iy = grid->ny - 1;
+    *cx = ix;
+    *cy = iy;
+    return iy * grid->nx + ix;
+}
+
+// Helper function: coordinates of an end reference (polyline * 2 + end)
+static void EndPoint(const OrderWork *work, int ref, float *x, float *y)
+{
+    const Polyline *line = &work->lines[ref >> 1];
+    int idx = (ref & 1) ? line->first + line->count - 1 : line->first;
+    *x = work->X[idx];
+    *y = work->Y[idx];
+}
+
+// Helper function: sorts both ends of every polyline into grid cells (counting sort)
+// Returns: 0 when successful, -1 if the arena is out of memory
+static int BuildEndGrid(EndGrid *grid, const OrderWork *work, StrokeArena *arena)
+{
+    int nEnds = work->nLines * 2;
+    float minX = INFINITY, maxX = -INFINITY, minY = INFINITY, maxY = -INFINITY;
+
+    for (int ref = 0; ref < nEnds; ref++)
+    {
+        float x, y;
+        EndPoint(work, ref, &x, &y);
+        if (x < minX) minX = x;
+        if (x > maxX) maxX = x;
+        if (y < minY) minY = y;
+        if (y > maxY) maxY = y;
+    }
+
+    float width = maxX - minX, height = maxY - minY;
+    int nCells = (nEnds < ORDER_MAX_CELLS) ? nEnds : ORDER_MAX_CELLS;   // About one end per cell
+    float cellSize = sqrtf((width * height) / (float)nCells);
+    if (cellSize < width / nCells) cellSize = width / nCells;           // Lines of text are long and flat
+    if (cellSize < height / nCells) cellSize = height / nCells;
+    if (!(cellSize > 0.01f)) cellSize = 0.01f;                           // All ends on one spot
+
+    grid->originX = minX;
+    grid->originY = minY;
+    grid->cellSize = cellSize;
+    grid->nx = (int)(width / cellSize) + 1;
+    grid->ny = (int)(height / cellSize) + 1;
+
+    int cells = grid->nx * grid->ny;
+    grid->cellStart = StrokeArenaAlloc(arena, (size_t)(cells + 1) * sizeof(int));
+    grid->cellCount = StrokeArenaAlloc(arena, (size_t)cells * sizeof(int));
+    grid->entries = StrokeArenaAlloc(arena, (size_t)nEnds * sizeof(int));
+    if (!grid->cellStart || !grid->cellCount || !grid->entries)
+    {
+        return -1;
+    }
+
+    memset(grid->cellCount, 0, (size_t)cells * sizeof(int));
+    for (int ref = 0; ref < nEnds; ref++)                    // Count the ends in each cell
+    {
+        float x, y;
+        int cx, cy;
+        EndPoint(work, ref, &x, &y);
+        grid->cellCount[CellOf(grid, x, y, &cx, &cy)]++;
+    }
+
+    grid->cellStart[0] = 0;
+    for (int cell = 0; cell < cells; cell++)                 // Prefix sums give each cell its range of entries
+    {
+        grid->cellStart[cell + 1] = grid->cellStart[cell] + grid->cellCount[cell];
+        grid->cellCount[cell] = 0;
+    }
+
+    for (int ref = 0; ref < nEnds; ref++)                    // Fill the ranges
+    {
+        float x, y;
+        int cx, cy;
+        EndPoint(work, ref, &x, &y);
+        int cell = CellOf(grid, x, y, &cx, &cy);
+        grid->entries[grid->cellStart[cell] + grid->cellCount[cell]++] = ref;
+    }
+    return 0;
+}
+
+// Helper function: takes both ends of a drawn polyline out of the grid
+static void RemoveFromGrid(EndGrid *grid, const OrderWork *work, int lineIdx)
+{
+    for (int end = 0; end < 2; end++)
+    {
+        float x, y;
+        int cx, cy;
+        int ref = lineIdx * 2 + end;
+        EndPoint(work, ref, &x, &y);
+        int cell = CellOf(grid, x, y, &cx, &cy);
+        int *entry = grid->entries + grid->cellStart[cell];
+
+        for (int slot = 0; slot < grid->cellCount[cell]; slot++)
+        {
+            if (entry[slot] == ref)
+            {
+                entry[slot] = entry[--grid->cellCount[cell]];  // Swap with the last entry in use
+                break;
+            }
+        }
+    }
+}
+
+// Helper function: nearest polyline end still in the grid, searching rings of cells outwards from x, y
+// Returns: end reference, -1 when the grid is empty
+static int NearestEnd(const EndGrid *grid, const OrderWork *work, float x, float y)
+{
+    int cx, cy;
+    int best = -1;
+    float bestDistance = INFINITY;
+    int maxRing = (grid->nx > grid->ny) ? grid->nx : grid->ny;
+
+    CellOf(grid, x, y, &cx, &cy);
+    for (int ring = 0; ring <= maxRing; ring++)
+    {
+        // Every end in a later ring is at least 'ring' cells away, so a closer end found so far is final
+        if (best >= 0 && bestDistance <= (float)(ring - 1) * grid->cellSize)
+        {
+            break;
+        }
+
+        for (int iy = cy - ring; iy <= cy + ring; iy++)
+        {
+            if (iy < 0 || iy >= grid->ny) continue;
+            int onEdge = (iy == cy - ring || iy == cy + ring);
+            for (int ix = cx - ring; ix <= cx + ring; ix += (onEdge || ring == 0) ? 1 : 2 * ring)   // Only the ring's border
+            {
+                if (ix < 0 || ix >= grid->nx) continue;
+                int cell = iy * grid->nx + ix;
+                const int *entry = grid->entries + grid->cellStart[cell];
+
+                for (int slot = 0; slot < grid->cellCount[cell]; slot++)
+                {
+                    float ex, ey;
+                    EndPoint(work, entry[slot], &ex, &ey);
+                    float distance = Distance(x, y, ex, ey);
+                    if (distance < bestDistance || (distance == bestDistance && entry[slot] < best))
+                    {
+                        bestDistance = distance;
+                        best = entry[slot];
+                    }
+                }
+            }
+        }
+    }
+    return best;
+}
+
+// Helper function: reverses the drawing order between positions i and j, which also reverses each polyline
+static void ReverseRange(OrderWork *work, int i, int j)
+{
+    while (i < j)
+    {
+        int order = work->order[i];
+        unsigned char flip = work->flip[i];
+        work->order[i] = work->order[j];
+        work->flip[i] = (unsigned char)!work->flip[j];
+        work->order[j] = order;
+        work->flip[j] = (unsigned char)!flip;
+        i++;
+        j--;
+    }
+    if (i == j)
+    {
+        work->flip[i] = (unsigned char)!work->flip[i];
+    }
+}
+
+// Helper function: 2-opt over the open path that starts at the pen position
+// Reversing positions i..j changes only the travel into i and out of j; reversal is accepted when it is shorter.
+// j = i is the same move for a single polyline: draw it the other way round.
+static void TwoOpt(OrderWork *work, float penX, float penY)
+{
+    int n = work->nLines;
+
+    for (int pass = 0; pass < TWO_OPT_PASSES; pass++)
+    {
+        int improved = 0;
+
+        for (int i = 0; i < n; i++)
+        {
+            float prevX = penX, prevY = penY;
+            if (i > 0) EndOf(work, i - 1, &prevX, &prevY);
+            int last = (i + TWO_OPT_WINDOW < n) ? i + TWO_OPT_WINDOW : n - 1;
+
+            for (int j = i; j <= last; j++)
+            {
+                float sIx, sIy, eJx, eJy;
+                StartOf(work, i, &sIx, &sIy);
+                EndOf(work, j, &eJx, &eJy);
+
+                float gain = Distance(prevX, prevY, sIx, sIy) - Distance(prevX, prevY, eJx, eJy);
+                if (j + 1 < n)
+                {
+                    float nextX, nextY;
+                    StartOf(work, j + 1, &nextX, &nextY);
+                    gain += Distance(eJx, eJy, nextX, nextY) - Distance(sIx, sIy, nextX, nextY);
+                }
+
+                if (gain > TWO_OPT_MIN_GAIN)
+                {
+                    ReverseRange(work, i, j);
+                    improved = 1;
+                }
+            }
+        }
+
+        if (!improved) break;
+    }
+}
+
+// Function: prepares the statistics of a job with stroke reordering
+void InitStrokeOrder(StrokeOrder *order)
+{
+    memset(order, 0, sizeof(*order));                        // The pen starts at (0,0) after the setup G-code
+}
+
+// Function: draws the pen-down polylines of one line of text in an order with less pen-up travel
+// The words' points are concatenated and split into polylines (a pen-up point and the pen-down points after it).
+// A nearest neighbour tour from the pen position, using a grid of polyline ends so each step only looks at
+// nearby cells, is improved by windowed 2-opt. Either end of a polyline may come first: a polyline drawn
+// backwards covers the same segments. Points that only move the pen are left out, the travel is implied.
+// Inputs: order (pen position and totals, updated), words (buffers of the line in text order), nWords,
+//         arena for the output and working arrays, out (receives the reordered points)
+// Returns: number of points in out, -1 if the arena is out of memory
+int OrderStrokes(StrokeOrder *order, const StrokeBuffer *words, int nWords, StrokeArena *arena, StrokeBuffer *out)
+{
+    int nPoints = 0;
+    for (int wordIdx = 0; wordIdx < nWords; wordIdx++)
+    {
+        nPoints += words[wordIdx].nPoints;
+    }
+
+    float *X = StrokeArenaAlloc(arena, (size_t)nPoints * sizeof(float));   // Concatenated input
+    float *Y = StrokeArenaAlloc(arena, (size_t)nPoints * sizeof(float));
+    unsigned char *Z = StrokeArenaAlloc(arena, (size_t)nPoints);
+    out->X = StrokeArenaAlloc(arena, (size_t)nPoints * sizeof(float));
+    out->Y = StrokeArenaAlloc(arena, (size_t)nPoints * sizeof(float));
+    out->Z = StrokeArenaAlloc(arena, (size_t)nPoints);
+    if (!X || !Y || !Z || !out->X || !out->Y || !out->Z)
+    {
+        return -1;
+    }
+
+    int n = 0;
+    for (int wordIdx = 0; wordIdx < nWords; wordIdx++)
+    {
+        memcpy(X + n, words[wordIdx].X, (size_t)words[wordIdx].nPoints * sizeof(float));
+        memcpy(Y + n, words[wordIdx].Y, (size_t)words[wordIdx].nPoints * sizeof(float));
+        memcpy(Z + n, words[wordIdx].Z, (size_t)words[wordIdx].nPoints);
+        n += words[wordIdx].nPoints;
+    }
+    order->travelBefore += PenUpTravel(X, Y, Z, nPoints, order->penX, order->penY);
+
+    OrderWork work;
+    work.X = X;
+    work.Y = Y;
+    work.lines = StrokeArenaAlloc(arena, (size_t)nPoints * sizeof(Polyline));
+    work.nLines = 0;
+    if (!work.lines)
+    {
+        return -1;
+    }
+
+    int ordered = (nPoints == 0 || Z[0] == 0);               // Pen-down points need a start point to be moved
+    for (int pointIdx = 0; ordered && pointIdx < nPoints; pointIdx++)
+    {
+        if (Z[pointIdx] == 0)                                // Pen-up point: a new polyline may start here
+        {
+            work.lines[work.nLines].first = pointIdx;
+            work.lines[work.nLines].count = 1;
+            work.nLines++;
+        }
+        else
+        {
+            work.lines[work.nLines - 1].count++;
+        }
+    }
+
+    int kept = 0;                                            // Leave out polylines that never put the pen down
+    for (int lineIdx = 0; lineIdx < work.nLines; lineIdx++)
+    {
+        if (work.lines[lineIdx].count > 1)
+        {
+            work.lines[kept++] = work.lines[lineIdx];
+        }
+    }
+    work.nLines = kept;
+
+    work.order = StrokeArenaAlloc(arena, (size_t)work.nLines * sizeof(int));
+    work.flip = StrokeArenaAlloc(arena, (size_t)work.nLines);
+    if (!work.order || !work.flip)
+    {
+        return -1;
+    }
+
+    EndGrid grid;
+    if (ordered && work.nLines > 0)
+    {
+        if (BuildEndGrid(&grid, &work, arena) != 0)
+        {
+            return -1;
+        }
+
+        float x = order->penX, y = order->penY;
+        for (int k = 0; k < work.nLines; k++)                // Nearest neighbour: always go to the closest free end
+        {
+            int ref = NearestEnd(&grid, &work, x, y);
+            work.order[k] = ref >> 1;
+            work.flip[k] = (unsigned char)(ref & 1);         // Reached at its end: draw it backwards
+            RemoveFromGrid(&grid, &work, ref >> 1);
+            EndOf(&work, k, &x, &y);
+        }
+
+        TwoOpt(&work, order->penX, order->penY);
+    }
+
+    // Write the polylines in their new order, every one starting with its pen-up point
+    out->nPoints = 0;
+    out->minX = out->minY = INFINITY;
+    out->maxX = out->maxY = -INFINITY;
+    if (!ordered)                                            // Starts with the pen down: keep the text order
+    {
+        memcpy(out->X, X, (size_t)nPoints * sizeof(float));
+        memcpy(out->Y, Y, (size_t)nPoints * sizeof(float));
+        memcpy(out->Z, Z, (size_t)nPoints);
+        out->nPoints = nPoints;
+    }
+    for (int k = 0; ordered && k < work.nLines; k++)
+    {
+        const Polyline *line = &work.lines[work.order[k]];
+        for (int step = 0; step < line->count; step++)
+        {
+            int idx = work.flip[k] ? line->first + line->count - 1 - step : line->first + step;
+            out->X[out->nPoints] = X[idx];
+            out->Y[out->nPoints] = Y[idx];
+            out->Z[out->nPoints] = (unsigned char)(step > 0);
+            out->nPoints++;
+        }
+        order->polylines++;
+        if (work.flip[k]) order->reversed++;
+    }
+
+    for (int pointIdx = 0; pointIdx < out->nPoints; pointIdx++)
+    {
+        if (out->X[pointIdx] < out->minX) out->minX = out->X[pointIdx];
+        if (out->X[pointIdx] > out->maxX) out->maxX = out->X[pointIdx];
+        if (out->Y[pointIdx] < out->minY) out->minY = out->Y[pointIdx];
+        if (out->Y[pointIdx] > out->maxY) out->maxY = out->Y[pointIdx];
+    }
+
+    order->travelAfter += PenUpTravel(out->X, out->Y, out->Z, out->nPoints, order->penX, order->penY);
+    if (out->nPoints > 0)
+    {
+        order->penX = out->X[out->nPoints - 1];              // The next line starts from here
+        order->penY = out->Y[out->nPoints - 1];
+    }
+    return out->nPoints;
+}
+
+// Function: prints the pen-up travel of the job before and after reordering
+void ReportStrokeOrder(const StrokeOrder *order)
+{
+    double saved = order->travelBefore - order->travelAfter;
+
+    printf("Pen-up travel: %.1f mm in font order, %.1f mm reordered (%.1f%% less), %lu of %lu polylines drawn backwards\n",
+           order->travelBefore, order->travelAfter,
+           order->travelBefore > 0.0 ? 100.0 * saved / order->travelBefore : 0.0,
+           order->reversed, order->polylines);
+}
@@ -0,0 +1,135 @@
+#include <math.h>
+
+#include "StrokeBuffer.h"
+
+// Helper function: distance in mm from point (x, y) to the segment from (x0, y0) to (x1, y1)
+// A segment of zero length (a closed stroke such as an 'o') measures the distance to its point
+static float SegmentDistance(float x, float y, float x0, float y0, float x1, float y1)
+{
+    float dx = x1 - x0;
+    float dy = y1 - y0;
+    float lengthSquared = dx * dx + dy * dy;
+    float t = 0.0f;
+
+    if (lengthSquared > 0.0f)
+    {
+        t = ((x - x0) * dx + (y - y0) * dy) / lengthSquared;
+        if (t < 0.0f) t = 0.0f;
+        if (t > 1.0f) t = 1.0f;
+    }
+
+    float px = x0 + t * dx - x;
+    float py = y0 + t * dy - y;
+    return sqrtf(px * px + py * py);
+}
+
+// Helper function: Ramer-Douglas-Peucker over points [first, last] of one polyline, marking the points to keep
+// The point furthest from the chord first..last is kept if it is further than tolerance, and both halves are
+// then handled the same way; otherwise every point between first and last is dropped. Ranges still to be
+// looked at wait on an explicit stack, so long strokes cannot overflow the call stack.
+static void MarkPolyline(const StrokeBuffer *strokes, int first, int last, float tolerance,
+                         unsigned char *keep, int *stack)
+{
+    int top = 0;
+
+    keep[first] = 1;
+    keep[last] = 1;
+    stack[top++] = first;
+    stack[top++] = last;
+
+    while (top > 0)
+    {
+        int end = stack[--top];
+        int start = stack[--top];
+        float furthest = -1.0f;
+        int split = -1;
+
+        for (int pointIdx = start + 1; pointIdx < end; pointIdx++)
+        {
+            float distance = SegmentDistance(strokes->X[pointIdx], strokes->Y[pointIdx],
+                                             strokes->X[start], strokes->Y[start],
+                                             strokes->X[end], strokes->Y[end]);
+            if (distance > furthest)
+            {
+                furthest = distance;
+                split = pointIdx;
+            }
+        }
+
+        if (split >= 0 && furthest > tolerance)
+        {
+            keep[split] = 1;
+            stack[top++] = start;                    // At most one range per point is ever waiting
+            stack[top++] = split;
+            stack[top++] = split;
+            stack[top++] = end;
+        }
+    }
+}
+
+// Function: removes stroke points that do not change the drawing by more than tolerance mm
+// Each pen-down polyline (its pen-up start point and the pen-down points after it) is simplified with
+// Ramer-Douglas-Peucker; the first and last point of every polyline and every pen-up point are always kept,
+// so the pen still goes down and up at the same places. Collinear runs collapse to a single G1.
+// Inputs: strokes (page coordinates, simplified in place), tolerance (mm), arena for the working arrays
+// Returns: number of points removed, -1 if the arena is out of memory (strokes unchanged)
+int SimplifyStrokes(StrokeBuffer *strokes, float tolerance, StrokeArena *arena)
+{
+    int nPoints = strokes->nPoints;
+    unsigned char *keep = StrokeArenaAlloc(arena, (size_t)nPoints);
+    int *stack = StrokeArenaAlloc(arena, (size_t)nPoints * 2 * sizeof(int));
+    if (!keep || !stack)
+    {
+        return -1;
+    }
+
+    int first = 0;
+    while (first < nPoints)
+    {
+        int last = first;                                    // A polyline runs on while the pen stays down
+        while (last + 1 < nPoints && strokes->Z[last + 1] == 1)
+        {
+            last++;
+        }
+
+        if (last - first >= 2)                               // Only polylines with inner points can lose any
+        {
+            for (int pointIdx = first + 1; pointIdx < last; pointIdx++)
+            {
+                keep[pointIdx] = 0;
+            }
+            MarkPolyline(strokes, first, last, tolerance, keep, stack);
+        }
+        else
+        {
+            for (int pointIdx = first; pointIdx <= last; pointIdx++)
+            {
+                keep[pointIdx] = 1;
+            }
+        }
+        first = last + 1;
+    }
+
+    int kept = 0;                                            // Close the gaps and refit the bounding box
+    strokes->minX = strokes->minY = INFINITY;
+    strokes->maxX = strokes->maxY = -INFINITY;
+    for (int pointIdx = 0; pointIdx < nPoints; pointIdx++)
+    {
+        if (!keep[pointIdx]) continue;
+
+        float x = strokes->X[pointIdx];
+        float y = strokes->Y[pointIdx];
+        strokes->X[kept] = x;
+        strokes->Y[kept] = y;
+        strokes->Z[kept] = strokes->Z[pointIdx];
+        kept++;
+
+        if (x < strokes->minX) strokes->minX = x;
+        if (x > strokes->maxX) strokes->maxX = x;
+        if (y < strokes->minY) strokes->minY = y;
+        if (y > strokes->maxY) strokes->maxY = y;
+    }
+
+    strokes->nPoints = kept;
+    return nPoints - kept;
+}
@@ -0,0 +1,418 @@
+// Generated by tools/EmbedFont from SingleStrokeFont.txt - do not edit by hand
+
+#include <stddef.h>
+
+#include "StrokeFont.h"
+
+static const StrokePoint EmbeddedPoints[889] = {
+    STROKE_POINT(0, 0, 0), STROKE_POINT(19, 0, 0), STROKE_POINT(3, 0, 1), STROKE_POINT(0, 3, 1), STROKE_POINT(0, 24, 1), STROKE_POINT(3, 27, 1),
+    STROKE_POINT(14, 27, 1), STROKE_POINT(20, 27, 0), STROKE_POINT(42, 27, 1), STROKE_POINT(45, 24, 1), STROKE_POINT(45, 3, 1), STROKE_POINT(42, 0, 1),
+    STROKE_POINT(25, 0, 1), STROKE_POINT(13, 9, 0), STROKE_POINT(17, 27, 1), STROKE_POINT(15, 18, 0), STROKE_POINT(19, 18, 1), STROKE_POINT(21, 16, 1),
+    STROKE_POINT(20, 9, 1), STROKE_POINT(22, 0, 0), STROKE_POINT(26, 18, 1), STROKE_POINT(30, 18, 1), STROKE_POINT(32, 16, 1), STROKE_POINT(31, 11, 1),
+    STROKE_POINT(29, 9, 1), STROKE_POINT(24, 9, 1), STROKE_POINT(54, 0, 0), STROKE_POINT(0, -7, 0), STROKE_POINT(1, 7, 1), STROKE_POINT(3, 16, 1),
+    STROKE_POINT(7, 18, 1), STROKE_POINT(12, 16, 1), STROKE_POINT(12, 10, 1), STROKE_POINT(8, 8, 1), STROKE_POINT(2, 8, 1), STROKE_POINT(8, 8, 0),
+    STROKE_POINT(11, 7, 1), STROKE_POINT(12, 3, 1), STROKE_POINT(9, 0, 1), STROKE_POINT(5, 0, 1), STROKE_POINT(1, 3, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(0, 0, 0), STROKE_POINT(0, 4, 1), STROKE_POINT(0, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(0, -4, 1), STROKE_POINT(0, 0, 0),
+    STROKE_POINT(0, 0, 0), STROKE_POINT(-4, 0, 1), STROKE_POINT(0, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(4, 0, 1), STROKE_POINT(0, 0, 0),
+    STROKE_POINT(-18, 0, 0), STROKE_POINT(0, -9, 0), STROKE_POINT(0, -36, 0), STROKE_POINT(0, 36, 0), STROKE_POINT(0, 9, 0), STROKE_POINT(0, 0, 0),
+    STROKE_POINT(-4, 0, 0), STROKE_POINT(4, 0, 1), STROKE_POINT(0, 0, 0), STROKE_POINT(0, 4, 0), STROKE_POINT(0, -4, 1), STROKE_POINT(0, 0, 0),
+    STROKE_POINT(4, 4, 0), STROKE_POINT(-4, -4, 1), STROKE_POINT(0, -5, 0), STROKE_POINT(0, 5, 1), STROKE_POINT(-4, 4, 0), STROKE_POINT(4, -4, 1),
+    STROKE_POINT(5, 0, 0), STROKE_POINT(-5, 0, 1), STROKE_POINT(0, 0, 0), STROKE_POINT(-2, -5, 0), STROKE_POINT(-5, -2, 1), STROKE_POINT(-5, 2, 1),
+    STROKE_POINT(-2, 5, 1), STROKE_POINT(2, 5, 1), STROKE_POINT(5, 2, 1), STROKE_POINT(5, -2, 1), STROKE_POINT(2, -5, 1), STROKE_POINT(-2, -5, 1),
+    STROKE_POINT(0, 0, 0), STROKE_POINT(0, 10, 0), STROKE_POINT(6, 18, 1), STROKE_POINT(12, 10, 1), STROKE_POINT(6, 18, 0), STROKE_POINT(6, 0, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(6, 3, 0), STROKE_POINT(0, 9, 1), STROKE_POINT(6, 15, 1), STROKE_POINT(0, 9, 0), STROKE_POINT(12, 9, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(0, 8, 0), STROKE_POINT(6, 0, 1), STROKE_POINT(12, 8, 1), STROKE_POINT(6, 0, 0), STROKE_POINT(6, 18, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(6, 3, 0), STROKE_POINT(12, 9, 1), STROKE_POINT(6, 15, 1), STROKE_POINT(0, 9, 0), STROKE_POINT(12, 9, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(0, 3, 0), STROKE_POINT(3, 0, 1), STROKE_POINT(6, 20, 1), STROKE_POINT(13, 20, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(3, 0, 0), STROKE_POINT(4, 12, 1), STROKE_POINT(9, 0, 0), STROKE_POINT(9, 12, 1), STROKE_POINT(0, 10, 0), STROKE_POINT(4, 12, 1),
+    STROKE_POINT(9, 12, 1), STROKE_POINT(12, 14, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(6, 15, 1), STROKE_POINT(12, 0, 1),
+    STROKE_POINT(0, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, -7, 0), STROKE_POINT(2, 11, 1), STROKE_POINT(1, 2, 0), STROKE_POINT(6, 0, 1),
+    STROKE_POINT(10, 2, 1), STROKE_POINT(11, 11, 1), STROKE_POINT(10, 2, 0), STROKE_POINT(13, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(6, 16, 0),
+    STROKE_POINT(4, 18, 1), STROKE_POINT(4, 21, 1), STROKE_POINT(6, 23, 1), STROKE_POINT(9, 23, 1), STROKE_POINT(11, 21, 1), STROKE_POINT(11, 18, 1),
+    STROKE_POINT(9, 16, 1), STROKE_POINT(6, 16, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(4, 0, 1), STROKE_POINT(1, 7, 1),
+    STROKE_POINT(1, 12, 1), STROKE_POINT(4, 16, 1), STROKE_POINT(9, 16, 1), STROKE_POINT(12, 12, 1), STROKE_POINT(12, 7, 1), STROKE_POINT(9, 0, 1),
+    STROKE_POINT(13, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, -7, 0), STROKE_POINT(3, 9, 1), STROKE_POINT(7, 12, 1), STROKE_POINT(11, 11, 1),
+    STROKE_POINT(13, 8, 1), STROKE_POINT(13, 4, 1), STROKE_POINT(10, 0, 1), STROKE_POINT(5, 0, 1), STROKE_POINT(2, 3, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(0, 0, 0), STROKE_POINT(4, 0, 1), STROKE_POINT(2, 0, 0), STROKE_POINT(2, 18, 1), STROKE_POINT(0, 18, 0), STROKE_POINT(12, 18, 1),
+    STROKE_POINT(12, 14, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(7, 0, 0), STROKE_POINT(2, 0, 1), STROKE_POINT(0, 4, 1), STROKE_POINT(0, 10, 1),
+    STROKE_POINT(2, 15, 1), STROKE_POINT(5, 18, 1), STROKE_POINT(10, 18, 1), STROKE_POINT(12, 14, 1), STROKE_POINT(12, 8, 1), STROKE_POINT(10, 3, 1),
+    STROKE_POINT(7, 0, 1), STROKE_POINT(0, 9, 0), STROKE_POINT(12, 9, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(6, 10, 1),
+    STROKE_POINT(0, 17, 0), STROKE_POINT(3, 18, 1), STROKE_POINT(9, 2, 1), STROKE_POINT(12, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(6, 0, 0), STROKE_POINT(6, 0, 1), STROKE_POINT(6, 5, 0), STROKE_POINT(6, 18, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(3, 14, 0),
+    STROKE_POINT(4, 18, 1), STROKE_POINT(7, 14, 0), STROKE_POINT(8, 18, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(2, 0, 0), STROKE_POINT(4, 18, 1),
+    STROKE_POINT(8, 0, 0), STROKE_POINT(10, 18, 1), STROKE_POINT(0, 13, 0), STROKE_POINT(12, 13, 1), STROKE_POINT(0, 5, 0), STROKE_POINT(12, 5, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(0, 3, 0), STROKE_POINT(3, 1, 1), STROKE_POINT(9, 1, 1), STROKE_POINT(12, 3, 1), STROKE_POINT(12, 7, 1),
+    STROKE_POINT(9, 9, 1), STROKE_POINT(3, 9, 1), STROKE_POINT(0, 11, 1), STROKE_POINT(0, 15, 1), STROKE_POINT(3, 17, 1), STROKE_POINT(9, 17, 1),
+    STROKE_POINT(12, 15, 1), STROKE_POINT(6, 19, 0), STROKE_POINT(6, -1, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(12, 18, 1),
+    STROKE_POINT(6, 14, 0), STROKE_POINT(3, 10, 1), STROKE_POINT(0, 14, 1), STROKE_POINT(3, 18, 1), STROKE_POINT(6, 14, 1), STROKE_POINT(9, 8, 0),
+    STROKE_POINT(12, 4, 1), STROKE_POINT(9, 0, 1), STROKE_POINT(6, 4, 1), STROKE_POINT(9, 8, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(12, 5, 0),
+    STROKE_POINT(8, 0, 1), STROKE_POINT(2, 0, 1), STROKE_POINT(0, 4, 1), STROKE_POINT(9, 14, 1), STROKE_POINT(7, 18, 1), STROKE_POINT(3, 18, 1),
+    STROKE_POINT(1, 14, 1), STROKE_POINT(12, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(5, 14, 0), STROKE_POINT(7, 18, 1), STROKE_POINT(7, 18, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(12, -2, 0), STROKE_POINT(6, 4, 1), STROKE_POINT(6, 14, 1), STROKE_POINT(12, 20, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(0, -2, 0), STROKE_POINT(6, 4, 1), STROKE_POINT(6, 14, 1), STROKE_POINT(0, 20, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(3, 2, 0),
+    STROKE_POINT(9, 16, 1), STROKE_POINT(3, 16, 0), STROKE_POINT(9, 2, 1), STROKE_POINT(0, 9, 0), STROKE_POINT(12, 9, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(6, 2, 0), STROKE_POINT(6, 16, 1), STROKE_POINT(0, 9, 0), STROKE_POINT(12, 9, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(4, -4, 0),
+    STROKE_POINT(6, 1, 1), STROKE_POINT(6, 1, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 9, 0), STROKE_POINT(12, 9, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(6, 0, 0), STROKE_POINT(6, 0, 1), STROKE_POINT(6, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(12, 18, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(1, 2, 0), STROKE_POINT(11, 16, 1), STROKE_POINT(12, 12, 0), STROKE_POINT(12, 6, 1), STROKE_POINT(9, 0, 1),
+    STROKE_POINT(3, 0, 1), STROKE_POINT(0, 6, 1), STROKE_POINT(0, 12, 1), STROKE_POINT(3, 18, 1), STROKE_POINT(9, 18, 1), STROKE_POINT(12, 12, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(3, 0, 0), STROKE_POINT(9, 0, 1), STROKE_POINT(6, 0, 0), STROKE_POINT(6, 18, 1), STROKE_POINT(3, 15, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(0, 15, 0), STROKE_POINT(3, 18, 1), STROKE_POINT(9, 18, 1), STROKE_POINT(12, 15, 1), STROKE_POINT(12, 11, 1),
+    STROKE_POINT(2, 5, 1), STROKE_POINT(0, 0, 1), STROKE_POINT(12, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 16, 0), STROKE_POINT(3, 18, 1),
+    STROKE_POINT(9, 18, 1), STROKE_POINT(12, 15, 1), STROKE_POINT(12, 11, 1), STROKE_POINT(9, 9, 1), STROKE_POINT(3, 9, 1), STROKE_POINT(9, 9, 0),
+    STROKE_POINT(12, 7, 1), STROKE_POINT(12, 3, 1), STROKE_POINT(9, 0, 1), STROKE_POINT(3, 0, 1), STROKE_POINT(0, 2, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(9, 0, 0), STROKE_POINT(9, 18, 1), STROKE_POINT(0, 6, 1), STROKE_POINT(12, 6, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 2, 0),
+    STROKE_POINT(3, 0, 1), STROKE_POINT(9, 0, 1), STROKE_POINT(12, 2, 1), STROKE_POINT(12, 8, 1), STROKE_POINT(9, 10, 1), STROKE_POINT(3, 10, 1),
+    STROKE_POINT(0, 9, 1), STROKE_POINT(2, 18, 1), STROKE_POINT(12, 18, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 7, 0), STROKE_POINT(3, 10, 1),
+    STROKE_POINT(9, 10, 1), STROKE_POINT(12, 7, 1), STROKE_POINT(12, 3, 1), STROKE_POINT(9, 0, 1), STROKE_POINT(3, 0, 1), STROKE_POINT(0, 3, 1),
+    STROKE_POINT(0, 10, 1), STROKE_POINT(3, 15, 1), STROKE_POINT(7, 18, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 18, 0), STROKE_POINT(12, 18, 1),
+    STROKE_POINT(4, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(3, 10, 0), STROKE_POINT(0, 13, 1), STROKE_POINT(0, 16, 1), STROKE_POINT(3, 19, 1),
+    STROKE_POINT(9, 19, 1), STROKE_POINT(12, 16, 1), STROKE_POINT(12, 13, 1), STROKE_POINT(9, 10, 1), STROKE_POINT(3, 10, 1), STROKE_POINT(0, 7, 1),
+    STROKE_POINT(0, 3, 1), STROKE_POINT(3, 0, 1), STROKE_POINT(9, 0, 1), STROKE_POINT(12, 3, 1), STROKE_POINT(12, 7, 1), STROKE_POINT(9, 10, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(5, 0, 0), STROKE_POINT(9, 3, 1), STROKE_POINT(12, 8, 1), STROKE_POINT(12, 15, 1), STROKE_POINT(9, 18, 1),
+    STROKE_POINT(3, 18, 1), STROKE_POINT(0, 15, 1), STROKE_POINT(0, 11, 1), STROKE_POINT(3, 8, 1), STROKE_POINT(9, 8, 1), STROKE_POINT(12, 11, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(6, 4, 0), STROKE_POINT(6, 4, 1), STROKE_POINT(6, 14, 0), STROKE_POINT(6, 14, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(5, -4, 0), STROKE_POINT(7, 0, 1), STROKE_POINT(7, 0, 1), STROKE_POINT(7, 10, 0), STROKE_POINT(7, 10, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(12, 0, 0), STROKE_POINT(0, 9, 1), STROKE_POINT(12, 18, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 4, 0), STROKE_POINT(12, 4, 1),
+    STROKE_POINT(0, 14, 0), STROKE_POINT(12, 14, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(12, 9, 1), STROKE_POINT(0, 18, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(0, 15, 0), STROKE_POINT(3, 18, 1), STROKE_POINT(9, 18, 1), STROKE_POINT(12, 15, 1), STROKE_POINT(12, 11, 1),
+    STROKE_POINT(6, 7, 1), STROKE_POINT(6, 4, 1), STROKE_POINT(6, 0, 0), STROKE_POINT(6, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(12, 2, 0),
+    STROKE_POINT(10, 0, 1), STROKE_POINT(3, 0, 1), STROKE_POINT(0, 3, 1), STROKE_POINT(0, 15, 1), STROKE_POINT(3, 18, 1), STROKE_POINT(9, 18, 1),
+    STROKE_POINT(12, 15, 1), STROKE_POINT(12, 6, 1), STROKE_POINT(5, 6, 1), STROKE_POINT(5, 13, 1), STROKE_POINT(12, 13, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(0, 0, 0), STROKE_POINT(6, 18, 1), STROKE_POINT(12, 0, 1), STROKE_POINT(3, 9, 0), STROKE_POINT(9, 9, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(0, 0, 0), STROKE_POINT(0, 18, 1), STROKE_POINT(9, 18, 1), STROKE_POINT(12, 15, 1), STROKE_POINT(12, 12, 1), STROKE_POINT(9, 9, 1),
+    STROKE_POINT(0, 9, 1), STROKE_POINT(9, 9, 0), STROKE_POINT(12, 6, 1), STROKE_POINT(12, 3, 1), STROKE_POINT(9, 0, 1), STROKE_POINT(0, 0, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(12, 3, 0), STROKE_POINT(9, 0, 1), STROKE_POINT(3, 0, 1), STROKE_POINT(0, 3, 1), STROKE_POINT(0, 15, 1),
+    STROKE_POINT(3, 18, 1), STROKE_POINT(9, 18, 1), STROKE_POINT(12, 15, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(0, 18, 1),
+    STROKE_POINT(9, 18, 1), STROKE_POINT(12, 15, 1), STROKE_POINT(12, 3, 1), STROKE_POINT(9, 0, 1), STROKE_POINT(0, 0, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(0, 0, 0), STROKE_POINT(0, 18, 1), STROKE_POINT(12, 18, 1), STROKE_POINT(0, 9, 0), STROKE_POINT(9, 9, 1), STROKE_POINT(0, 0, 0),
+    STROKE_POINT(12, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(0, 18, 1), STROKE_POINT(12, 18, 1), STROKE_POINT(0, 9, 0),
+    STROKE_POINT(9, 9, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(12, 15, 0), STROKE_POINT(9, 18, 1), STROKE_POINT(3, 18, 1), STROKE_POINT(0, 15, 1),
+    STROKE_POINT(0, 3, 1), STROKE_POINT(3, 0, 1), STROKE_POINT(9, 0, 1), STROKE_POINT(12, 3, 1), STROKE_POINT(12, 8, 1), STROKE_POINT(5, 8, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(0, 18, 1), STROKE_POINT(12, 0, 0), STROKE_POINT(12, 18, 1), STROKE_POINT(0, 9, 0),
+    STROKE_POINT(12, 9, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(2, 0, 0), STROKE_POINT(10, 0, 1), STROKE_POINT(6, 0, 0), STROKE_POINT(6, 18, 1),
+    STROKE_POINT(2, 18, 0), STROKE_POINT(10, 18, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 2, 0), STROKE_POINT(3, 0, 1), STROKE_POINT(5, 0, 1),
+    STROKE_POINT(8, 2, 1), STROKE_POINT(8, 18, 1), STROKE_POINT(4, 18, 0), STROKE_POINT(12, 18, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0),
+    STROKE_POINT(0, 18, 1), STROKE_POINT(12, 18, 0), STROKE_POINT(0, 6, 1), STROKE_POINT(3, 9, 0), STROKE_POINT(12, 0, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(0, 0, 0), STROKE_POINT(0, 18, 1), STROKE_POINT(0, 0, 0), STROKE_POINT(12, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0),
+    STROKE_POINT(0, 18, 1), STROKE_POINT(6, 5, 1), STROKE_POINT(12, 18, 1), STROKE_POINT(12, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0),
+    STROKE_POINT(0, 18, 1), STROKE_POINT(12, 0, 1), STROKE_POINT(12, 18, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(3, 0, 0), STROKE_POINT(0, 3, 1),
+    STROKE_POINT(0, 15, 1), STROKE_POINT(3, 18, 1), STROKE_POINT(9, 18, 1), STROKE_POINT(12, 15, 1), STROKE_POINT(12, 3, 1), STROKE_POINT(9, 0, 1),
+    STROKE_POINT(3, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(0, 18, 1), STROKE_POINT(9, 18, 1), STROKE_POINT(12, 15, 1),
+    STROKE_POINT(12, 11, 1), STROKE_POINT(9, 8, 1), STROKE_POINT(0, 8, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(3, 0, 0), STROKE_POINT(0, 3, 1),
+    STROKE_POINT(0, 15, 1), STROKE_POINT(3, 18, 1), STROKE_POINT(9, 18, 1), STROKE_POINT(12, 15, 1), STROKE_POINT(12, 3, 1), STROKE_POINT(9, 0, 1),
+    STROKE_POINT(3, 0, 1), STROKE_POINT(7, 5, 0), STROKE_POINT(14, -2, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(0, 18, 1),
+    STROKE_POINT(9, 18, 1), STROKE_POINT(12, 15, 1), STROKE_POINT(12, 11, 1), STROKE_POINT(9, 8, 1), STROKE_POINT(0, 8, 1), STROKE_POINT(7, 8, 0),
+    STROKE_POINT(12, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 2, 0), STROKE_POINT(3, 0, 1), STROKE_POINT(9, 0, 1), STROKE_POINT(12, 3, 1),
+    STROKE_POINT(12, 6, 1), STROKE_POINT(9, 9, 1), STROKE_POINT(3, 9, 1), STROKE_POINT(0, 12, 1), STROKE_POINT(0, 15, 1), STROKE_POINT(3, 18, 1),
+    STROKE_POINT(9, 18, 1), STROKE_POINT(12, 16, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(6, 0, 0), STROKE_POINT(6, 18, 1), STROKE_POINT(0, 18, 0),
+    STROKE_POINT(12, 18, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 18, 0), STROKE_POINT(0, 3, 1), STROKE_POINT(3, 0, 1), STROKE_POINT(9, 0, 1),
+    STROKE_POINT(12, 3, 1), STROKE_POINT(12, 18, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 18, 0), STROKE_POINT(6, 0, 1), STROKE_POINT(12, 18, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(0, 18, 0), STROKE_POINT(3, 0, 1), STROKE_POINT(6, 14, 1), STROKE_POINT(9, 0, 1), STROKE_POINT(12, 18, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(12, 18, 1), STROKE_POINT(0, 18, 0), STROKE_POINT(12, 0, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(6, 0, 0), STROKE_POINT(6, 7, 1), STROKE_POINT(0, 18, 1), STROKE_POINT(6, 7, 0), STROKE_POINT(12, 18, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(0, 0, 0), STROKE_POINT(12, 18, 1), STROKE_POINT(0, 18, 1), STROKE_POINT(12, 0, 0), STROKE_POINT(0, 0, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(12, 20, 0), STROKE_POINT(6, 20, 1), STROKE_POINT(6, -2, 1), STROKE_POINT(12, -2, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 18, 0),
+    STROKE_POINT(12, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, -2, 0), STROKE_POINT(6, -2, 1), STROKE_POINT(6, 20, 1), STROKE_POINT(0, 20, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(0, 7, 0), STROKE_POINT(6, 16, 1), STROKE_POINT(12, 7, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(-18, -5, 0),
+    STROKE_POINT(0, -5, 1), STROKE_POINT(0, 0, 0), STROKE_POINT(5, 18, 0), STROKE_POINT(5, 18, 1), STROKE_POINT(7, 14, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(0, 10, 0), STROKE_POINT(5, 12, 1), STROKE_POINT(11, 10, 1), STROKE_POINT(11, 2, 1), STROKE_POINT(8, 0, 1), STROKE_POINT(4, 0, 1),
+    STROKE_POINT(0, 2, 1), STROKE_POINT(0, 5, 1), STROKE_POINT(11, 6, 1), STROKE_POINT(11, 2, 0), STROKE_POINT(13, 0, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(0, 0, 0), STROKE_POINT(0, 18, 1), STROKE_POINT(0, 9, 0), STROKE_POINT(6, 11, 1), STROKE_POINT(12, 9, 1), STROKE_POINT(12, 2, 1),
+    STROKE_POINT(6, 0, 1), STROKE_POINT(0, 2, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(11, 9, 0), STROKE_POINT(6, 11, 1), STROKE_POINT(0, 9, 1),
+    STROKE_POINT(0, 2, 1), STROKE_POINT(6, 0, 1), STROKE_POINT(11, 2, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(12, 2, 0), STROKE_POINT(6, 0, 1),
+    STROKE_POINT(0, 2, 1), STROKE_POINT(0, 9, 1), STROKE_POINT(6, 11, 1), STROKE_POINT(12, 9, 1), STROKE_POINT(12, 18, 0), STROKE_POINT(12, 0, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(0, 6, 0), STROKE_POINT(12, 7, 1), STROKE_POINT(9, 12, 1), STROKE_POINT(3, 12, 1), STROKE_POINT(0, 9, 1),
+    STROKE_POINT(0, 2, 1), STROKE_POINT(3, 0, 1), STROKE_POINT(9, 0, 1), STROKE_POINT(12, 2, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(4, 0, 0),
+    STROKE_POINT(4, 16, 1), STROKE_POINT(8, 18, 1), STROKE_POINT(12, 16, 1), STROKE_POINT(0, 9, 0), STROKE_POINT(8, 9, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(11, 2, 0), STROKE_POINT(6, 0, 1), STROKE_POINT(0, 2, 1), STROKE_POINT(0, 9, 1), STROKE_POINT(6, 11, 1), STROKE_POINT(11, 9, 1),
+    STROKE_POINT(11, 11, 0), STROKE_POINT(11, -5, 1), STROKE_POINT(6, -7, 1), STROKE_POINT(0, -5, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0),
+    STROKE_POINT(0, 18, 1), STROKE_POINT(0, 9, 0), STROKE_POINT(6, 11, 1), STROKE_POINT(12, 9, 1), STROKE_POINT(12, 0, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(7, 0, 0), STROKE_POINT(7, 11, 1), STROKE_POINT(4, 11, 1), STROKE_POINT(7, 18, 0), STROKE_POINT(7, 18, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(0, -5, 0), STROKE_POINT(4, -7, 1), STROKE_POINT(8, -5, 1), STROKE_POINT(8, 11, 1), STROKE_POINT(8, 18, 0), STROKE_POINT(8, 18, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(0, 18, 1), STROKE_POINT(0, 5, 0), STROKE_POINT(12, 11, 1), STROKE_POINT(4, 7, 0),
+    STROKE_POINT(12, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(3, 0, 0), STROKE_POINT(9, 0, 1), STROKE_POINT(6, 0, 0), STROKE_POINT(6, 18, 1),
+    STROKE_POINT(3, 18, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(0, 12, 1), STROKE_POINT(0, 9, 0), STROKE_POINT(4, 12, 1),
+    STROKE_POINT(6, 9, 1), STROKE_POINT(6, 0, 1), STROKE_POINT(6, 9, 0), STROKE_POINT(10, 12, 1), STROKE_POINT(12, 9, 1), STROKE_POINT(12, 0, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(0, 11, 1), STROKE_POINT(0, 8, 0), STROKE_POINT(6, 11, 1), STROKE_POINT(12, 8, 1),
+    STROKE_POINT(12, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(6, 0, 0), STROKE_POINT(0, 2, 1), STROKE_POINT(0, 9, 1), STROKE_POINT(6, 11, 1),
+    STROKE_POINT(12, 9, 1), STROKE_POINT(12, 2, 1), STROKE_POINT(6, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, -7, 0), STROKE_POINT(0, 11, 1),
+    STROKE_POINT(0, 9, 0), STROKE_POINT(6, 11, 1), STROKE_POINT(12, 9, 1), STROKE_POINT(12, 2, 1), STROKE_POINT(6, 0, 1), STROKE_POINT(0, 2, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(11, 2, 0), STROKE_POINT(6, 0, 1), STROKE_POINT(0, 2, 1), STROKE_POINT(0, 9, 1), STROKE_POINT(6, 11, 1),
+    STROKE_POINT(11, 9, 1), STROKE_POINT(11, 11, 0), STROKE_POINT(11, -6, 1), STROKE_POINT(13, -8, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0),
+    STROKE_POINT(0, 11, 1), STROKE_POINT(0, 8, 0), STROKE_POINT(6, 11, 1), STROKE_POINT(12, 8, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 2, 0),
+    STROKE_POINT(6, 0, 1), STROKE_POINT(12, 2, 1), STROKE_POINT(12, 5, 1), STROKE_POINT(0, 7, 1), STROKE_POINT(0, 10, 1), STROKE_POINT(6, 12, 1),
+    STROKE_POINT(12, 10, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(12, 2, 0), STROKE_POINT(8, 0, 1), STROKE_POINT(4, 2, 1), STROKE_POINT(4, 18, 1),
+    STROKE_POINT(0, 11, 0), STROKE_POINT(8, 11, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 11, 0), STROKE_POINT(0, 2, 1), STROKE_POINT(6, 0, 1),
+    STROKE_POINT(12, 2, 1), STROKE_POINT(12, 11, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 11, 0), STROKE_POINT(6, 0, 1), STROKE_POINT(12, 11, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(0, 11, 0), STROKE_POINT(3, 0, 1), STROKE_POINT(6, 8, 1), STROKE_POINT(9, 0, 1), STROKE_POINT(12, 11, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(11, 11, 1), STROKE_POINT(0, 11, 0), STROKE_POINT(11, 0, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(0, 11, 0), STROKE_POINT(7, 1, 1), STROKE_POINT(3, -7, 0), STROKE_POINT(12, 11, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, 11, 0),
+    STROKE_POINT(12, 11, 1), STROKE_POINT(0, 0, 1), STROKE_POINT(12, 0, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(12, -2, 0), STROKE_POINT(7, 1, 1),
+    STROKE_POINT(7, 6, 1), STROKE_POINT(4, 9, 1), STROKE_POINT(7, 12, 1), STROKE_POINT(7, 17, 1), STROKE_POINT(12, 20, 1), STROKE_POINT(18, 0, 0),
+    STROKE_POINT(6, 0, 0), STROKE_POINT(6, 6, 1), STROKE_POINT(6, 12, 0), STROKE_POINT(6, 18, 1), STROKE_POINT(18, 0, 0), STROKE_POINT(0, -2, 0),
+    STROKE_POINT(5, 1, 1), STROKE_POINT(5, 6, 1), STROKE_POINT(8, 9, 1), STROKE_POINT(5, 12, 1), STROKE_POINT(5, 17, 1), STROKE_POINT(0, 20, 1),
+    STROKE_POINT(18, 0, 0), STROKE_POINT(0, 0, 0), STROKE_POINT(0, 53, 1), STROKE_POINT(53, 53, 1), STROKE_POINT(53, 0, 1), STROKE_POINT(0, 0, 1),
+    STROKE_POINT(56, 0, 0)
+};
+
+const GlyphData EmbeddedFontGlyphs[FONT_TABLE_SIZE] = {
+    { 1, 1, EmbeddedPoints + 0, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 0
+    { 1, 26, EmbeddedPoints + 1, 0.0f, 54.0f, 0.0f, 27.0f, 54.0f },   // 1
+    { 1, 15, EmbeddedPoints + 27, 0.0f, 18.0f, -7.0f, 18.0f, 18.0f },   // 2
+    { 1, 0, EmbeddedPoints + 42, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 3
+    { 1, 3, EmbeddedPoints + 42, 0.0f, 0.0f, 0.0f, 4.0f, 0.0f },   // 4
+    { 1, 3, EmbeddedPoints + 45, 0.0f, 0.0f, -4.0f, 0.0f, 0.0f },   // 5
+    { 1, 3, EmbeddedPoints + 48, -4.0f, 0.0f, 0.0f, 0.0f, 4.0f },   // 6
+    { 1, 3, EmbeddedPoints + 51, 0.0f, 4.0f, 0.0f, 0.0f, 4.0f },   // 7
+    { 1, 1, EmbeddedPoints + 54, -18.0f, -18.0f, 0.0f, 0.0f, 0.0f },   // 8
+    { 1, 1, EmbeddedPoints + 55, 0.0f, 0.0f, -9.0f, -9.0f, 0.0f },   // 9
+    { 1, 1, EmbeddedPoints + 56, 0.0f, 0.0f, -36.0f, -36.0f, 0.0f },   // 10
+    { 1, 1, EmbeddedPoints + 57, 0.0f, 0.0f, 36.0f, 36.0f, 0.0f },   // 11
+    { 1, 1, EmbeddedPoints + 58, 0.0f, 0.0f, 9.0f, 9.0f, 0.0f },   // 12
+    { 1, 1, EmbeddedPoints + 59, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 13
+    { 1, 3, EmbeddedPoints + 60, -4.0f, 4.0f, 0.0f, 0.0f, 8.0f },   // 14
+    { 1, 3, EmbeddedPoints + 63, 0.0f, 0.0f, -4.0f, 4.0f, 0.0f },   // 15
+    { 1, 9, EmbeddedPoints + 66, -5.0f, 5.0f, -5.0f, 5.0f, 10.0f },   // 16
+    { 1, 10, EmbeddedPoints + 75, -5.0f, 5.0f, -5.0f, 5.0f, 10.0f },   // 17
+    { 1, 6, EmbeddedPoints + 85, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 18
+    { 1, 6, EmbeddedPoints + 91, 0.0f, 18.0f, 0.0f, 15.0f, 18.0f },   // 19
+    { 1, 6, EmbeddedPoints + 97, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 20
+    { 1, 6, EmbeddedPoints + 103, 0.0f, 18.0f, 0.0f, 15.0f, 18.0f },   // 21
+    { 1, 5, EmbeddedPoints + 109, 0.0f, 18.0f, 0.0f, 20.0f, 18.0f },   // 22
+    { 1, 9, EmbeddedPoints + 114, 0.0f, 18.0f, 0.0f, 14.0f, 18.0f },   // 23
+    { 1, 5, EmbeddedPoints + 123, 0.0f, 18.0f, 0.0f, 15.0f, 18.0f },   // 24
+    { 1, 9, EmbeddedPoints + 128, 0.0f, 18.0f, -7.0f, 11.0f, 18.0f },   // 25
+    { 1, 10, EmbeddedPoints + 137, 4.0f, 18.0f, 0.0f, 23.0f, 14.0f },   // 26
+    { 1, 11, EmbeddedPoints + 147, 0.0f, 18.0f, 0.0f, 16.0f, 18.0f },   // 27
+    { 1, 10, EmbeddedPoints + 158, 0.0f, 18.0f, -7.0f, 12.0f, 18.0f },   // 28
+    { 1, 8, EmbeddedPoints + 168, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 29
+    { 1, 14, EmbeddedPoints + 176, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 30
+    { 1, 7, EmbeddedPoints + 190, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 31
+    { 1, 1, EmbeddedPoints + 197, 18.0f, 18.0f, 0.0f, 0.0f, 0.0f },   // 32
+    { 1, 5, EmbeddedPoints + 198, 6.0f, 18.0f, 0.0f, 18.0f, 12.0f },   // 33
+    { 1, 5, EmbeddedPoints + 203, 3.0f, 18.0f, 0.0f, 18.0f, 15.0f },   // 34
+    { 1, 9, EmbeddedPoints + 208, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 35
+    { 1, 15, EmbeddedPoints + 217, 0.0f, 18.0f, -1.0f, 19.0f, 18.0f },   // 36
+    { 1, 13, EmbeddedPoints + 232, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 37
+    { 1, 10, EmbeddedPoints + 245, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 38
+    { 1, 4, EmbeddedPoints + 255, 5.0f, 18.0f, 0.0f, 18.0f, 13.0f },   // 39
+    { 1, 5, EmbeddedPoints + 259, 6.0f, 18.0f, -2.0f, 20.0f, 12.0f },   // 40
+    { 1, 5, EmbeddedPoints + 264, 0.0f, 18.0f, -2.0f, 20.0f, 18.0f },   // 41
+    { 1, 7, EmbeddedPoints + 269, 0.0f, 18.0f, 0.0f, 16.0f, 18.0f },   // 42
+    { 1, 5, EmbeddedPoints + 276, 0.0f, 18.0f, 0.0f, 16.0f, 18.0f },   // 43
+    { 1, 4, EmbeddedPoints + 281, 4.0f, 18.0f, -4.0f, 1.0f, 14.0f },   // 44
+    { 1, 3, EmbeddedPoints + 285, 0.0f, 18.0f, 0.0f, 9.0f, 18.0f },   // 45
+    { 1, 4, EmbeddedPoints + 288, 6.0f, 18.0f, 0.0f, 0.0f, 12.0f },   // 46
+    { 1, 3, EmbeddedPoints + 292, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 47
+    { 1, 12, EmbeddedPoints + 295, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 48
+    { 1, 6, EmbeddedPoints + 307, 3.0f, 18.0f, 0.0f, 18.0f, 15.0f },   // 49
+    { 1, 9, EmbeddedPoints + 313, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 50
+    { 1, 14, EmbeddedPoints + 322, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 51
+    { 1, 5, EmbeddedPoints + 336, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 52
+    { 1, 11, EmbeddedPoints + 341, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 53
+    { 1, 12, EmbeddedPoints + 352, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 54
+    { 1, 4, EmbeddedPoints + 364, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 55
+    { 1, 17, EmbeddedPoints + 368, 0.0f, 18.0f, 0.0f, 19.0f, 18.0f },   // 56
+    { 1, 12, EmbeddedPoints + 385, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 57
+    { 1, 5, EmbeddedPoints + 397, 6.0f, 18.0f, 0.0f, 14.0f, 12.0f },   // 58
+    { 1, 6, EmbeddedPoints + 402, 5.0f, 18.0f, -4.0f, 10.0f, 13.0f },   // 59
+    { 1, 4, EmbeddedPoints + 408, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 60
+    { 1, 5, EmbeddedPoints + 412, 0.0f, 18.0f, 0.0f, 14.0f, 18.0f },   // 61
+    { 1, 4, EmbeddedPoints + 417, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 62
+    { 1, 10, EmbeddedPoints + 421, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 63
+    { 1, 13, EmbeddedPoints + 431, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 64
+    { 1, 6, EmbeddedPoints + 444, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 65
+    { 1, 13, EmbeddedPoints + 450, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 66
+    { 1, 9, EmbeddedPoints + 463, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 67
+    { 1, 8, EmbeddedPoints + 472, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 68
+    { 1, 8, EmbeddedPoints + 480, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 69
+    { 1, 6, EmbeddedPoints + 488, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 70
+    { 1, 11, EmbeddedPoints + 494, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 71
+    { 1, 7, EmbeddedPoints + 505, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 72
+    { 1, 7, EmbeddedPoints + 512, 2.0f, 18.0f, 0.0f, 18.0f, 16.0f },   // 73
+    { 1, 8, EmbeddedPoints + 519, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 74
+    { 1, 7, EmbeddedPoints + 527, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 75
+    { 1, 5, EmbeddedPoints + 534, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 76
+    { 1, 6, EmbeddedPoints + 539, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 77
+    { 1, 5, EmbeddedPoints + 545, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 78
+    { 1, 10, EmbeddedPoints + 550, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 79
+    { 1, 8, EmbeddedPoints + 560, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 80
+    { 1, 12, EmbeddedPoints + 568, 0.0f, 18.0f, -2.0f, 18.0f, 18.0f },   // 81
+    { 1, 10, EmbeddedPoints + 580, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 82
+    { 1, 13, EmbeddedPoints + 590, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 83
+    { 1, 5, EmbeddedPoints + 603, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 84
+    { 1, 7, EmbeddedPoints + 608, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 85
+    { 1, 4, EmbeddedPoints + 615, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 86
+    { 1, 6, EmbeddedPoints + 619, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 87
+    { 1, 5, EmbeddedPoints + 625, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 88
+    { 1, 6, EmbeddedPoints + 630, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 89
+    { 1, 6, EmbeddedPoints + 636, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 90
+    { 1, 5, EmbeddedPoints + 642, 6.0f, 18.0f, -2.0f, 20.0f, 12.0f },   // 91
+    { 1, 3, EmbeddedPoints + 647, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 92
+    { 1, 5, EmbeddedPoints + 650, 0.0f, 18.0f, -2.0f, 20.0f, 18.0f },   // 93
+    { 1, 4, EmbeddedPoints + 655, 0.0f, 18.0f, 0.0f, 16.0f, 18.0f },   // 94
+    { 1, 3, EmbeddedPoints + 659, -18.0f, 0.0f, -5.0f, 0.0f, 18.0f },   // 95
+    { 1, 4, EmbeddedPoints + 662, 5.0f, 18.0f, 0.0f, 18.0f, 13.0f },   // 96
+    { 1, 12, EmbeddedPoints + 666, 0.0f, 18.0f, 0.0f, 12.0f, 18.0f },   // 97
+    { 1, 9, EmbeddedPoints + 678, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 98
+    { 1, 7, EmbeddedPoints + 687, 0.0f, 18.0f, 0.0f, 11.0f, 18.0f },   // 99
+    { 1, 9, EmbeddedPoints + 694, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 100
+    { 1, 10, EmbeddedPoints + 703, 0.0f, 18.0f, 0.0f, 12.0f, 18.0f },   // 101
+    { 1, 7, EmbeddedPoints + 713, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 102
+    { 1, 11, EmbeddedPoints + 720, 0.0f, 18.0f, -7.0f, 11.0f, 18.0f },   // 103
+    { 1, 7, EmbeddedPoints + 731, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 104
+    { 1, 6, EmbeddedPoints + 738, 4.0f, 18.0f, 0.0f, 18.0f, 14.0f },   // 105
+    { 1, 7, EmbeddedPoints + 744, 0.0f, 18.0f, -7.0f, 18.0f, 18.0f },   // 106
+    { 1, 7, EmbeddedPoints + 751, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 107
+    { 1, 6, EmbeddedPoints + 758, 3.0f, 18.0f, 0.0f, 18.0f, 15.0f },   // 108
+    { 1, 11, EmbeddedPoints + 764, 0.0f, 18.0f, 0.0f, 12.0f, 18.0f },   // 109
+    { 1, 7, EmbeddedPoints + 775, 0.0f, 18.0f, 0.0f, 11.0f, 18.0f },   // 110
+    { 1, 8, EmbeddedPoints + 782, 0.0f, 18.0f, 0.0f, 11.0f, 18.0f },   // 111
+    { 1, 9, EmbeddedPoints + 790, 0.0f, 18.0f, -7.0f, 11.0f, 18.0f },   // 112
+    { 1, 10, EmbeddedPoints + 799, 0.0f, 18.0f, -8.0f, 11.0f, 18.0f },   // 113
+    { 1, 6, EmbeddedPoints + 809, 0.0f, 18.0f, 0.0f, 11.0f, 18.0f },   // 114
+    { 1, 9, EmbeddedPoints + 815, 0.0f, 18.0f, 0.0f, 12.0f, 18.0f },   // 115
+    { 1, 7, EmbeddedPoints + 824, 0.0f, 18.0f, 0.0f, 18.0f, 18.0f },   // 116
+    { 1, 6, EmbeddedPoints + 831, 0.0f, 18.0f, 0.0f, 11.0f, 18.0f },   // 117
+    { 1, 4, EmbeddedPoints + 837, 0.0f, 18.0f, 0.0f, 11.0f, 18.0f },   // 118
+    { 1, 6, EmbeddedPoints + 841, 0.0f, 18.0f, 0.0f, 11.0f, 18.0f },   // 119
+    { 1, 5, EmbeddedPoints + 847, 0.0f, 18.0f, 0.0f, 11.0f, 18.0f },   // 120
+    { 1, 5, EmbeddedPoints + 852, 0.0f, 18.0f, -7.0f, 11.0f, 18.0f },   // 121
+    { 1, 5, EmbeddedPoints + 857, 0.0f, 18.0f, 0.0f, 11.0f, 18.0f },   // 122
+    { 1, 8, EmbeddedPoints + 862, 4.0f, 18.0f, -2.0f, 20.0f, 14.0f },   // 123
+    { 1, 5, EmbeddedPoints + 870, 6.0f, 18.0f, 0.0f, 18.0f, 12.0f },   // 124
+    { 1, 8, EmbeddedPoints + 875, 0.0f, 18.0f, -2.0f, 20.0f, 18.0f },   // 125
+    { 1, 6, EmbeddedPoints + 883, 0.0f, 56.0f, 0.0f, 53.0f, 56.0f },   // 126
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 127
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 128
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 129
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 130
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 131
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 132
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 133
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 134
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 135
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 136
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 137
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 138
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 139
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 140
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 141
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 142
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 143
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 144
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 145
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 146
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 147
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 148
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 149
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 150
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 151
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 152
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 153
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 154
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 155
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 156
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 157
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 158
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 159
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 160
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 161
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 162
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 163
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 164
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 165
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 166
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 167
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 168
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 169
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 170
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 171
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 172
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 173
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 174
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 175
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 176
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 177
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 178
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 179
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 180
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 181
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 182
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 183
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 184
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 185
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 186
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 187
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 188
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 189
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 190
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 191
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 192
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 193
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 194
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 195
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 196
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 197
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 198
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 199
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 200
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 201
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 202
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 203
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 204
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 205
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 206
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 207
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 208
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 209
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 210
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 211
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 212
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 213
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 214
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 215
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 216
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 217
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 218
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 219
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 220
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 221
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 222
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 223
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 224
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 225
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 226
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 227
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 228
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 229
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 230
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 231
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 232
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 233
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 234
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 235
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 236
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 237
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 238
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 239
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 240
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 241
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 242
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 243
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 244
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 245
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 246
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 247
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 248
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 249
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 250
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 251
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 252
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 253
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 254
+    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // 255
+};
+
+const int EmbeddedFontPoints = 889;
@@ -0,0 +1,89 @@
+#include <stdlib.h>
+
+#include "StrokeArena.h"
+
+#define ARENA_ALIGN       16                                  /* Alignment of every allocation (enough for SSE/AVX loads) */
+#define ARENA_MIN_BLOCK   (16 * 1024)                         /* Smallest block requested from malloc */
+#define ARENA_HEADER_SIZE ((sizeof(ArenaBlock) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+
+// Helper function: allocates a new block of at least 'capacity' bytes and makes it the current block
+// Returns: 0 when successful, -1 if malloc failed (the arena is unchanged)
+static int AddArenaBlock(StrokeArena *arena, size_t capacity)
+{
+    if (capacity < ARENA_MIN_BLOCK) capacity = ARENA_MIN_BLOCK;
+
+    ArenaBlock *block = malloc(ARENA_HEADER_SIZE + capacity);
+    if (block == NULL)
+    {
+        return -1;
+    }
+
+    block->next = arena->head;                   // Earlier blocks stay valid until the next reset
+    block->capacity = capacity;
+    block->used = 0;
+    arena->head = block;
+    arena->totalCapacity += capacity;
+    return 0;
+}
+
+// Function: prepares an empty arena; no memory is allocated until the first StrokeArenaAlloc
+void StrokeArenaInit(StrokeArena *arena)
+{
+    arena->head = NULL;
+    arena->totalCapacity = 0;
+}
+
+// Function: hands out 'bytes' bytes from the arena, aligned to ARENA_ALIGN
+// When the current block is full a larger one is added, so earlier pointers are never moved
+// Returns: pointer to the memory, NULL if more memory could not be allocated
+void *StrokeArenaAlloc(StrokeArena *arena, size_t bytes)
+{
+    size_t rounded = (bytes + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+
+    if (arena->head == NULL || arena->head->capacity - arena->head->used < rounded)
+    {
+        size_t grow = (arena->head != NULL) ? 2 * arena->head->capacity : 0;   // Double the block size on each overflow
+        if (AddArenaBlock(arena, (grow > rounded) ? grow : rounded) != 0)
+        {
+            return NULL;
+        }
+    }
+
+    void *memory = (unsigned char *)arena->head + ARENA_HEADER_SIZE + arena->head->used;
+    arena->head->used += rounded;
+    return memory;
+}
+
+// Function: releases everything allocated from the arena in a single call
+// If the last word or line needed more than one block, they are replaced by one block of the combined
+// size so that the following words fit in a single block without further mallocs
+void StrokeArenaReset(StrokeArena *arena)
+{
+    if (arena->head == NULL) return;
+
+    if (arena->head->next != NULL)
+    {
+        size_t combined = arena->totalCapacity;
+        StrokeArenaFree(arena);
+        AddArenaBlock(arena, combined);          // On failure the arena is simply empty again
+        return;
+    }
+
+    arena->head->used = 0;                       // Single block: just rewind it
+}
+
+// Memory cleanup function: returns all blocks to the system, leaving an empty arena
+void StrokeArenaFree(StrokeArena *arena)
+{
+    ArenaBlock *block = arena->head;
+
+    while (block != NULL)
+    {
+        ArenaBlock *next = block->next;
+        free(block);
+        block = next;
+    }
+
+    arena->head = NULL;
+    arena->totalCapacity = 0;
+}
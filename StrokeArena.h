@@ -0,0 +1,27 @@
+#include <stddef.h>
+
+
+#ifndef STROKEARENA_H_INCLUDED
+#define STROKEARENA_H_INCLUDED
+
+
+// One block of arena memory; the arrays handed out follow the header
+typedef struct ArenaBlock {
+    struct ArenaBlock *next;           // Older, smaller block that filled up before this one
+    size_t capacity;                   // Usable bytes in this block
+    size_t used;                       // Bytes already handed out from this block
+} ArenaBlock;
+
+// Bump allocator for the per-word (or per-line) working memory: glyph instances and stroke buffers
+// Everything allocated since the last reset is released together by StrokeArenaReset
+typedef struct {
+    ArenaBlock *head;                  // Block currently being allocated from, NULL before the first allocation
+    size_t totalCapacity;              // Capacity of all blocks, used to size the single block kept on reset
+} StrokeArena;
+
+void  StrokeArenaInit(StrokeArena *arena);                  // Start with an empty arena (no memory yet)
+void *StrokeArenaAlloc(StrokeArena *arena, size_t bytes);   // Hand out aligned memory, NULL if out of memory
+void  StrokeArenaReset(StrokeArena *arena);                 // Release every allocation at once, keeping the memory
+void  StrokeArenaFree(StrokeArena *arena);                  // Return all arena memory to the system
+
+#endif // STROKEARENA_H_INCLUDED
@@ -0,0 +1,52 @@
+#include "StrokeFont.h"
+#include "StrokeArena.h"
+
+
+#ifndef STROKEBUFFER_H_INCLUDED
+#define STROKEBUFFER_H_INCLUDED
+
+
+// Stroke points of a word or line in page coordinates (mm), one array per coordinate
+typedef struct {
+    int   nPoints;           // Number of points in the arrays
+    float *X;                // Page X of every point
+    float *Y;                // Page Y of every point
+    unsigned char *Z;        // Pen state of every point (0 = pen up, 1 = pen down)
+    float minX, maxX;        // Bounding box of all points, valid when nPoints > 0
+    float minY, maxY;
+} StrokeBuffer;
+
+// Drop points that move a pen-down polyline by no more than tolerance mm (Ramer-Douglas-Peucker), in place
+int SimplifyStrokes(StrokeBuffer *strokes, float tolerance, StrokeArena *arena);
+
+// Circular arc through consecutive stroke points, found by FitArc
+typedef struct {
+    int   end;                   // Index of the arc's last point
+    float centreX, centreY;      // Centre in page coordinates (mm)
+    int   counterClockwise;      // 1 for G3, 0 for G2
+} StrokeArc;
+
+// Longest arc from point 'first' through at most 'last' that stays within tolerance mm of the points
+int FitArc(const StrokeBuffer *strokes, int first, int last, float tolerance, StrokeArc *arc);
+
+// Totals of a job drawn with OrderStrokes
+typedef struct {
+    float penX, penY;            // Pen position after the last line drawn, where the next line starts
+    double travelBefore;         // Pen-up travel in mm had the strokes been drawn in font order
+    double travelAfter;          // Pen-up travel in mm in the order drawn
+    unsigned long polylines;     // Pen-down polylines drawn
+    unsigned long reversed;      // Of which drawn from their last point back to their first
+} StrokeOrder;
+
+// Place every glyph instance's points on the page and compute their bounding box in one pass
+int TransformStrokes(const GlyphInstance *chars, int nChars, StrokeArena *arena, StrokeBuffer *strokes);
+// Plain C version of the same kernel, kept as the reference for tools/BenchTransform
+int TransformStrokesScalar(const GlyphInstance *chars, int nChars, StrokeArena *arena, StrokeBuffer *strokes);
+
+
+void InitStrokeOrder(StrokeOrder *order);                   // Pen at (0,0), totals cleared
+// Reorder the pen-down polylines of one line of text (its words' buffers) to shorten pen-up travel
+int  OrderStrokes(StrokeOrder *order, const StrokeBuffer *words, int nWords, StrokeArena *arena, StrokeBuffer *out);
+void ReportStrokeOrder(const StrokeOrder *order);           // Print travel before and after
+
+#endif // STROKEBUFFER_H_INCLUDED
@@ -0,0 +1,81 @@
+#include <stdio.h>
+#include <stdint.h>
+
+#include "MapFile.h"
+
+
+#ifndef STROKEFONT_H_INCLUDED
+#define STROKEFONT_H_INCLUDED
+
+
+#define FONT_TABLE_SIZE 256            /* One glyph slot for every possible byte value */
+
+#define FONT_BINARY_MAGIC   0x42535353  /* "SSSB" in a little-endian file, a byte-swapped file fails this check */
+#define FONT_BINARY_VERSION 2
+
+// One stroke point packed into 4 bytes; font coordinates are small integers
+// The pen state rides in the lowest bit of YP, so Y is limited to -16384..16383 font units
+typedef struct {
+    int16_t X;               // X coordinate in font units
+    int16_t YP;              // Y coordinate * 2, plus 1 when the pen is down
+} StrokePoint;
+
+#define STROKE_POINT(X, Y, Z)   { (int16_t)(X), (int16_t)((Y) * 2 + ((Z) ? 1 : 0)) }   /* Initializer for a packed point */
+#define STROKE_POINT_X(p)       ((p).X)                                                /* X coordinate in font units */
+#define STROKE_POINT_PEN(p)     ((p).YP & 1)                                           /* 1 = pen down, 0 = pen up */
+#define STROKE_POINT_Y(p)       (((p).YP - STROKE_POINT_PEN(p)) / 2)                   /* Y coordinate in font units */
+
+// Read-only stroke data for one glyph, pointing into the font's contiguous point array
+typedef struct {
+    int   defined;           // 1 if the font file contains this character, 0 otherwise
+    int   nMoves;            // Number of stroke points for this glyph
+    const StrokePoint *points;  // First stroke point of this glyph inside the font's point array
+    float minX, maxX;        // Horizontal extent of all stroke points, in font units
+    float minY, maxY;        // Vertical extent of all stroke points, in font units
+    float advance;           // Unscaled width the glyph occupies on the line (maxX - minX)
+} GlyphData;
+
+// One character placed on the page: a reference to the shared, read-only glyph plus its placement
+// A stroke point (X, Y) of the glyph is drawn at page position
+//     (x + (X - glyph->minX) * scale,  y + Y * scale)
+// so the glyph's points are never copied, and repeated letters share the same font data
+typedef struct {
+    int   ascii;             // ASCII code for this character
+    const GlyphData *glyph;  // Font glyph to draw
+    float x;                 // Page X (mm) of the glyph's leftmost point
+    float y;                 // Page Y (mm) of the text baseline
+    float scale;             // Millimetres per font unit
+} GlyphInstance;
+
+// Whole font held in memory: ASCII indexed glyph table plus one contiguous array of packed points
+typedef struct {
+    GlyphData glyphs[FONT_TABLE_SIZE];  // Glyph lookup table indexed by ASCII code
+    int   nPoints;                      // Total number of stroke points stored for all glyphs
+    StrokePoint *points;                // All stroke points, glyph after glyph (NULL if not owned)
+    MappedFile map;                     // Binary font file the glyphs point into, if loaded with LoadFontBinary
+} FontTable;
+
+// Binary font file layout: this header, then StrokePoint points[nPoints]
+// Values are stored in the byte order of the machine that ran the converter
+typedef struct {
+    uint32_t magic;                     // FONT_BINARY_MAGIC
+    uint32_t version;                   // FONT_BINARY_VERSION
+    uint32_t nGlyphs;                   // Number of defined glyphs
+    uint32_t nPoints;                   // Length of the point array that follows the header
+    struct {
+        uint32_t start;                 // Index of the glyph's first point in the point array
+        int32_t  nMoves;                // Number of stroke points, -1 if the glyph is not defined
+    } glyphs[FONT_TABLE_SIZE];          // Glyph offset table indexed by ASCII code
+} FontBinaryHeader;
+
+extern const GlyphData EmbeddedFontGlyphs[FONT_TABLE_SIZE];    // Glyph table generated by tools/EmbedFont
+extern const int EmbeddedFontPoints;                            // Number of stroke points in the embedded font
+
+int  LoadFontTable(FILE *fontFile, FontTable *font);            // Parse the text font file once into a FontTable
+int  LoadFontBinary(const char *path, FontTable *font);         // Memory-map a binary font file made by MakeBinaryFont
+int  SaveFontBinary(FILE *out, const FontTable *font);          // Write a loaded FontTable in the binary font format
+int  LoadFontEmbedded(FontTable *font);                         // Use the font compiled into the program
+void ComputeGlyphMetrics(GlyphData *glyph);                     // Fill in a glyph's bounding box and advance width
+void FreeFontTable(FontTable *font);                            // Release the memory or mapping owned by a FontTable
+
+#endif // STROKEFONT_H_INCLUDED
@@ -0,0 +1,30 @@
+#include <stddef.h>
+
+#include "MapFile.h"
+
+
+#ifndef TEXTREADER_H_INCLUDED
+#define TEXTREADER_H_INCLUDED
+
+
+// Whole input text held in memory (mapped when possible) and handed out one word at a time
+typedef struct {
+    const char *text;        // First byte of the input text
+    size_t size;             // Number of bytes of input text
+    size_t pos;              // Offset of the next byte TexttoWordArray will look at
+    MappedFile map;          // Mapping of the input file, when it could be mapped
+    char *buffer;            // Heap copy of the input, when it had to be read instead
+} TextReader;
+
+// One word of the input: points into the reader's text, so it is not NUL-terminated and has no length limit
+typedef struct {
+    const char *start;       // First character of the word
+    size_t length;           // Number of characters in the word
+    size_t offset;           // Byte offset of the word from the start of the input file
+} WordView;
+
+int  OpenTextReader(const char *path, TextReader *reader);     // Map or read the input file, returns 0 on success
+int  TexttoWordArray(TextReader *reader, WordView *word);      // Next word, returns 1 if found, 0 at end of text
+void CloseTextReader(TextReader *reader);                      // Release the mapping or buffer
+
+#endif // TEXTREADER_H_INCLUDED
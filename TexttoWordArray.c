@@ -1,39 +1,109 @@
 #include <stdio.h>           
+#include <stdlib.h>
+#include <string.h>
 #include <ctype.h>           
 
-// Function reads one word from input file
-// Inputs: file pointer, destination buffer, maximum buffer size 
-// Returns: 1 if word successfully read, 0 if end of file or error
-int TexttoWordArray(FILE *file, char *word_buffer, int maxLengthWord)
+#include "TextReader.h"
+
+#define TEXT_READ_CHUNK (1024 * 1024)   /* Bytes read per fread call when the file cannot be mapped */
+
+// Function opens the input text for word-by-word reading
+// The file is memory-mapped so words can be handed out without copying; if mapping is not possible
+// (empty file, pipe, ...) it is read into one buffer in large chunks instead of one character at a time
+// Inputs: path of the text file, destination TextReader
+// Returns: 0 when successful, -1 if the file could not be opened or read
+int OpenTextReader(const char *path, TextReader *reader)
 {
-    int inputChar;               // Stores the character read from file
-    int writePos = 0;            // Current position in word_buffer where next character will be written
+    memset(reader, 0, sizeof(*reader));
 
-    if (file == NULL || word_buffer == NULL || maxLengthWord <= 1)  // Check for NULL pointers or if the buffer is too small
-        return 0;                // Return failure if any input is invalid
+    if (MapFile(path, &reader->map) == 0)
+    {
+        reader->text = reader->map.data;         // Words point straight into the mapped file
+        reader->size = reader->map.size;
+        return 0;
+    }
+
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        return -1;                               // File does not exist or cannot be read
+    }
 
-    do {
-        inputChar = fgetc(file); // Read one character from the file
-        if (inputChar == EOF)    // Check if end of file reached (no more characters)
+    size_t capacity = 0;
+    size_t bytesRead;
+    do
+    {
+        if (capacity - reader->size < TEXT_READ_CHUNK)
         {
-            word_buffer[0] = '\0'; // Empty buffer
-            return 0;            // Return failure (no word found, end of file)
+            capacity = (capacity > 0) ? 2 * capacity : TEXT_READ_CHUNK;
+            char *grown = realloc(reader->buffer, capacity);
+            if (grown == NULL)
+            {
+                fclose(file);
+                CloseTextReader(reader);
+                return -1;                       // Out of memory
+            }
+            reader->buffer = grown;
         }
-    } while (isspace(inputChar));
+        bytesRead = fread(reader->buffer + reader->size, 1, capacity - reader->size, file);
+        reader->size += bytesRead;
+    } while (bytesRead > 0);
+
+    int failed = ferror(file);
+    fclose(file);
+    if (failed)
+    {
+        CloseTextReader(reader);
+        return -1;
+    }
+
+    reader->text = reader->buffer;
+    return 0;
+}
 
-    word_buffer[writePos++] = (char)inputChar;  // Store character at current position, increment writePos
+// Function finds the next word in the input text
+// A word is a run of non-whitespace bytes; it is returned as a view into the text, without copying
+// Inputs: open TextReader, destination WordView
+// Returns: 1 if word successfully read, 0 if end of text or error
+int TexttoWordArray(TextReader *reader, WordView *word)
+{
+    if (reader == NULL || word == NULL || reader->text == NULL)  // Check for NULL pointers or a reader that is not open
+        return 0;                // Return failure if any input is invalid
 
-    while (writePos < maxLengthWord - 1)         // Continue while space remains
+    const unsigned char *text = (const unsigned char *)reader->text;
+    size_t pos = reader->pos;    // Current position in the text
+    size_t size = reader->size;
+
+    while (pos < size && isspace(text[pos]))     // Skip whitespace before the word
     {
-        inputChar = fgetc(file);                 // Read next character from file
-        if (inputChar == EOF || isspace(inputChar)) // Check for end of word
-        {
-            break;                               // Exit loop, word is complete
-        }
-        word_buffer[writePos++] = (char)inputChar; // Store character and advance write position
+        pos++;
+    }
+    if (pos == size)             // Check if end of text reached (no more words)
+    {
+        reader->pos = pos;
+        return 0;                // Return failure (no word found, end of text)
     }
 
-    word_buffer[writePos] = '\0';                // Add string terminator at current write position
+    size_t wordStart = pos;
+    while (pos < size && !isspace(text[pos]))    // Continue until whitespace or end of text
+    {
+        pos++;
+    }
+
+    word->start = reader->text + wordStart;      // View of the word inside the text
+    word->length = pos - wordStart;
+    word->offset = wordStart;
+    reader->pos = pos;           // Next call continues after this word
+
+    return 1;                    // Word successfully read
+}
+
+// Memory cleanup function: releases the mapping or buffer holding the input text
+void CloseTextReader(TextReader *reader)
+{
+    if (reader == NULL) return;
 
-    return 1;                                    // Word successfully read
+    UnmapFile(&reader->map);
+    free(reader->buffer);
+    memset(reader, 0, sizeof(*reader));
 }
@@ -0,0 +1,218 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "StrokeBuffer.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define TRANSFORM_LANES 8                /* Widest vector step, in points */
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define TRANSFORM_LANES 4
+#else
+#define TRANSFORM_LANES 1                /* No vector unit: everything goes through the scalar loop */
+#endif
+
+// Helper function: takes the output arrays for every point of the word or line from the arena
+// Returns: total number of points, -1 if the arena is out of memory
+static int AllocStrokeBuffer(const GlyphInstance *chars, int nChars, StrokeArena *arena, StrokeBuffer *strokes)
+{
+    int nPoints = 0;
+
+    for (int charIdx = 0; charIdx < nChars; charIdx++)
+    {
+        nPoints += chars[charIdx].glyph->nMoves;
+    }
+
+    strokes->nPoints = 0;
+    strokes->X = StrokeArenaAlloc(arena, (size_t)nPoints * sizeof(float));
+    strokes->Y = StrokeArenaAlloc(arena, (size_t)nPoints * sizeof(float));
+    strokes->Z = StrokeArenaAlloc(arena, (size_t)nPoints);
+    if (!strokes->X || !strokes->Y || !strokes->Z)
+    {
+        return -1;
+    }
+
+    strokes->minX = strokes->minY = INFINITY;    // Widened by every point written
+    strokes->maxX = strokes->maxY = -INFINITY;
+    return nPoints;
+}
+
+// Helper function: transforms points [first, count) of one glyph with plain C and widens the bounding box
+// Same arithmetic as the vector paths, so all paths produce identical coordinates
+static void TransformGlyphScalar(const GlyphInstance *instance, int first, float *X, float *Y, unsigned char *Z,
+                                 float *minX, float *maxX, float *minY, float *maxY)
+{
+    const GlyphData *glyph = instance->glyph;
+
+    for (int moveIdx = first; moveIdx < glyph->nMoves; moveIdx++)
+    {
+        StrokePoint point = glyph->points[moveIdx];
+        float globalX = instance->x + (((float)STROKE_POINT_X(point) - glyph->minX) * instance->scale);
+        float globalY = instance->y + ((float)STROKE_POINT_Y(point) * instance->scale);
+
+        X[moveIdx] = globalX;
+        Y[moveIdx] = globalY;
+        Z[moveIdx] = (unsigned char)STROKE_POINT_PEN(point);
+
+        if (globalX < *minX) *minX = globalX;
+        if (globalX > *maxX) *maxX = globalX;
+        if (globalY < *minY) *minY = globalY;
+        if (globalY > *maxY) *maxY = globalY;
+    }
+}
+
+// Function: plain C transform of a whole word or line into page coordinates
+// Inputs: placed glyph instances, count, arena for the output arrays, destination StrokeBuffer
+// Returns: number of points written, -1 if the arena is out of memory
+int TransformStrokesScalar(const GlyphInstance *chars, int nChars, StrokeArena *arena, StrokeBuffer *strokes)
+{
+    if (AllocStrokeBuffer(chars, nChars, arena, strokes) < 0)
+    {
+        return -1;
+    }
+
+    for (int charIdx = 0; charIdx < nChars; charIdx++)
+    {
+        int n = strokes->nPoints;
+        TransformGlyphScalar(&chars[charIdx], 0, strokes->X + n, strokes->Y + n, strokes->Z + n,
+                             &strokes->minX, &strokes->maxX, &strokes->minY, &strokes->maxY);
+        strokes->nPoints += chars[charIdx].glyph->nMoves;
+    }
+    return strokes->nPoints;
+}
+
+// Function: transforms a whole word or line of glyph instances into page coordinates
+// Every packed point (X, YP) of each glyph is unpacked, scaled and translated by the instance placement,
+// written to the structure-of-arrays output and folded into the bounding box, all in the same pass.
+// Uses AVX2 steps of 8 points (when the compiler targets AVX2) and SSE2 steps of 4 points, with the
+// plain C loop for the last few points of each glyph and on CPUs without SSE2.
+// Inputs: placed glyph instances, count, arena for the output arrays, destination StrokeBuffer
+// Returns: number of points written, -1 if the arena is out of memory
+int TransformStrokes(const GlyphInstance *chars, int nChars, StrokeArena *arena, StrokeBuffer *strokes)
+{
+#if TRANSFORM_LANES == 1
+    return TransformStrokesScalar(chars, nChars, arena, strokes);
+#else
+    if (AllocStrokeBuffer(chars, nChars, arena, strokes) < 0)
+    {
+        return -1;
+    }
+
+    float minX = INFINITY, maxX = -INFINITY;     // Scalar bounds for the glyph tails
+    float minY = INFINITY, maxY = -INFINITY;
+
+    __m128 vMinX = _mm_set1_ps(INFINITY), vMaxX = _mm_set1_ps(-INFINITY);   // Bounds of the 4 point steps
+    __m128 vMinY = _mm_set1_ps(INFINITY), vMaxY = _mm_set1_ps(-INFINITY);
+#if defined(__AVX2__)
+    __m256 wMinX = _mm256_set1_ps(INFINITY), wMaxX = _mm256_set1_ps(-INFINITY);   // Bounds of the 8 point steps
+    __m256 wMinY = _mm256_set1_ps(INFINITY), wMaxY = _mm256_set1_ps(-INFINITY);
+#endif
+
+    for (int charIdx = 0; charIdx < nChars; charIdx++)
+    {
+        const GlyphInstance *instance = &chars[charIdx];
+        const GlyphData *glyph = instance->glyph;
+        float *X = strokes->X + strokes->nPoints;
+        float *Y = strokes->Y + strokes->nPoints;
+        unsigned char *Z = strokes->Z + strokes->nPoints;
+        int moveIdx = 0;
+
+#if defined(__AVX2__)
+        __m256 originX8 = _mm256_set1_ps(instance->x);
+        __m256 originY8 = _mm256_set1_ps(instance->y);
+        __m256 scale8 = _mm256_set1_ps(instance->scale);
+        __m256 glyphMinX8 = _mm256_set1_ps(glyph->minX);
+        __m256i one8 = _mm256_set1_epi32(1);
+
+        for (; moveIdx + 8 <= glyph->nMoves; moveIdx += 8)
+        {
+            // Each 32 bit lane holds one StrokePoint: X in the low half, YP in the high half
+            __m256i packed = _mm256_loadu_si256((const __m256i *)(glyph->points + moveIdx));
+            __m256i rawX = _mm256_srai_epi32(_mm256_slli_epi32(packed, 16), 16);
+            __m256i rawYP = _mm256_srai_epi32(packed, 16);
+            __m256i pen = _mm256_and_si256(rawYP, one8);
+            __m256i rawY = _mm256_srai_epi32(rawYP, 1);          // (2Y + pen) >> 1 == Y
+
+            __m256 globalX = _mm256_add_ps(originX8, _mm256_mul_ps(_mm256_sub_ps(_mm256_cvtepi32_ps(rawX), glyphMinX8), scale8));
+            __m256 globalY = _mm256_add_ps(originY8, _mm256_mul_ps(_mm256_cvtepi32_ps(rawY), scale8));
+
+            _mm256_storeu_ps(X + moveIdx, globalX);
+            _mm256_storeu_ps(Y + moveIdx, globalY);
+
+            // Narrow the eight 32 bit pen states to bytes
+            __m128i pen16 = _mm_packs_epi32(_mm256_castsi256_si128(pen), _mm256_extracti128_si256(pen, 1));
+            __m128i pen8 = _mm_packus_epi16(pen16, pen16);
+            _mm_storel_epi64((__m128i *)(Z + moveIdx), pen8);
+
+            wMinX = _mm256_min_ps(wMinX, globalX);
+            wMaxX = _mm256_max_ps(wMaxX, globalX);
+            wMinY = _mm256_min_ps(wMinY, globalY);
+            wMaxY = _mm256_max_ps(wMaxY, globalY);
+        }
+#endif
+        __m128 originX = _mm_set1_ps(instance->x);
+        __m128 originY = _mm_set1_ps(instance->y);
+        __m128 scale = _mm_set1_ps(instance->scale);
+        __m128 glyphMinX = _mm_set1_ps(glyph->minX);
+        __m128i one = _mm_set1_epi32(1);
+
+        for (; moveIdx + 4 <= glyph->nMoves; moveIdx += 4)
+        {
+            // Each 32 bit lane holds one StrokePoint: X in the low half, YP in the high half
+            __m128i packed = _mm_loadu_si128((const __m128i *)(glyph->points + moveIdx));
+            __m128i rawX = _mm_srai_epi32(_mm_slli_epi32(packed, 16), 16);
+            __m128i rawYP = _mm_srai_epi32(packed, 16);
+            __m128i pen = _mm_and_si128(rawYP, one);
+            __m128i rawY = _mm_srai_epi32(rawYP, 1);             // (2Y + pen) >> 1 == Y
+
+            __m128 globalX = _mm_add_ps(originX, _mm_mul_ps(_mm_sub_ps(_mm_cvtepi32_ps(rawX), glyphMinX), scale));
+            __m128 globalY = _mm_add_ps(originY, _mm_mul_ps(_mm_cvtepi32_ps(rawY), scale));
+
+            _mm_storeu_ps(X + moveIdx, globalX);
+            _mm_storeu_ps(Y + moveIdx, globalY);
+
+            // Narrow the four 32 bit pen states to bytes
+            __m128i pen16 = _mm_packs_epi32(pen, pen);
+            __m128i pen8 = _mm_packus_epi16(pen16, pen16);
+            int penBytes = _mm_cvtsi128_si32(pen8);
+            memcpy(Z + moveIdx, &penBytes, 4);
+
+            vMinX = _mm_min_ps(vMinX, globalX);
+            vMaxX = _mm_max_ps(vMaxX, globalX);
+            vMinY = _mm_min_ps(vMinY, globalY);
+            vMaxY = _mm_max_ps(vMaxY, globalY);
+        }
+
+        TransformGlyphScalar(instance, moveIdx, X, Y, Z, &minX, &maxX, &minY, &maxY);   // Remaining points of this glyph
+        strokes->nPoints += glyph->nMoves;
+    }
+
+    // Fold the vector bounds into the scalar ones
+#if defined(__AVX2__)
+    vMinX = _mm_min_ps(vMinX, _mm_min_ps(_mm256_castps256_ps128(wMinX), _mm256_extractf128_ps(wMinX, 1)));
+    vMaxX = _mm_max_ps(vMaxX, _mm_max_ps(_mm256_castps256_ps128(wMaxX), _mm256_extractf128_ps(wMaxX, 1)));
+    vMinY = _mm_min_ps(vMinY, _mm_min_ps(_mm256_castps256_ps128(wMinY), _mm256_extractf128_ps(wMinY, 1)));
+    vMaxY = _mm_max_ps(vMaxY, _mm_max_ps(_mm256_castps256_ps128(wMaxY), _mm256_extractf128_ps(wMaxY, 1)));
+#endif
+    float lanes[4][4];
+    _mm_storeu_ps(lanes[0], vMinX);
+    _mm_storeu_ps(lanes[1], vMaxX);
+    _mm_storeu_ps(lanes[2], vMinY);
+    _mm_storeu_ps(lanes[3], vMaxY);
+    for (int lane = 0; lane < 4; lane++)
+    {
+        if (lanes[0][lane] < minX) minX = lanes[0][lane];
+        if (lanes[1][lane] > maxX) maxX = lanes[1][lane];
+        if (lanes[2][lane] < minY) minY = lanes[2][lane];
+        if (lanes[3][lane] > maxY) maxY = lanes[3][lane];
+    }
+
+    strokes->minX = minX;
+    strokes->maxX = maxX;
+    strokes->minY = minY;
+    strokes->maxY = maxY;
+    return strokes->nPoints;
+#endif
+}
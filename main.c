@@ -1,62 +1,168 @@
 #include <stdio.h>           
 #include <stdlib.h>          
+#include <string.h>
 #include "rs232.h"           
 #include "serial.h"          
+#include "StrokeFont.h"
+#include "StrokeArena.h"
+#include "StrokeBuffer.h"
+#include "TextReader.h"
+#include "CommandQueue.h"
+#include "GcodeWriter.h"
+#include "GcodeEmitter.h"
+#include "GlyphCache.h"
 
 #define bdrate 115200        // Define the baud rate for serial communication 
 
-// Define a structure to hold stroke data for a single character
-typedef struct {
-    int   ascii;             // ASCII code for this character
-    int   nMoves;            // Number of stroke points (coordinates) for this character
-    float *X;                // Dynamically allocated array of X coordinates for each stroke point
-    float *Y;                // Dynamically allocated array of Y coordinates for each stroke point
-    int   *Z;                // Dynamically allocated array of pen states (0 = pen up, 1 = pen down)
-} StrokeData;
-
 // Function prototypes:
-int TexttoWordArray(FILE *file, char *word_buffer, int maxLengthWord);
-int WordArraytoASCII(const char *word, int *TextToAscii, int maxLengthASCII);
-int ExtractStrokeData(const int *TextToAscii, int len, FILE *stroke_data, StrokeData *chars, int maxChars);
-void ScaleandAdjustStrokeData(StrokeData *chars, int nChars, float FontSize, float *curX, float *curY, float maxWidth, float maxHeight);
-void ConvertStrokestoGcode(StrokeData *chars, int nChars, char *buffer);
-void FreeStrokeData(StrokeData *stroke);
+int ExtractStrokeData(const char *word, int wordLength, size_t wordOffset, const FontTable *font, GlyphInstance *chars, int *nUnknown);
+int ScaleandAdjustStrokeData(GlyphInstance *chars, int nChars, float FontSize, float *curX, float *curY, float maxWidth, float maxHeight);
+void ConvertStrokestoGcode(const StrokeBuffer *strokes, GcodeEmitter *emitter, float arcTolerance);
 
 // Function prototype: sends one G-code string in buffer to the robot
 void SendCommands(char *buffer);
 
-int main(void)                        
+// Function prototype: reorders the strokes of the collected words of one line and sends them to the robot
+static int DrawLine(StrokeOrder *order, const StrokeBuffer *lineWords, int nLineWords, StrokeArena *arena, GcodeEmitter *emitter, float arcTolerance);
+
+// Function prototype: loads the stroke font from SingleStrokeFont.bin, SingleStrokeFont.txt or the built-in copy
+int LoadStrokeFont(FontTable *font);
+
+static GcodeWriter *gcodeOutput = NULL;              // Offline job: SendCommands writes to this file instead of the robot
+
+int main(int argc, char *argv[])
 {
-    FILE *user_text = fopen("InputText.txt", "r");   // Open the user input text file in read mode
-    if (user_text == NULL)                           // Check if the file failed to open
+    const char *inputPath = "InputText.txt";                 // Text to draw (-i)
+    const char *outputPath = NULL;                           // G-code file for an offline job (-o), NULL to draw on the robot
+    float FontSize;                                          // Variable to store user-selected font height in mm
+    int  haveFontSize = 0;                                   // Set when the height was given with -s, so there is no prompt
+    int  compact = 0;                                        // Leave out modal repeats in the G-code (-c)
+    int  optimize = 0;                                       // Peephole pass over travels and pen commands (-p)
+    float joinDistance = 0.0f;                               // Draw through pen-up gaps up to this many mm (-j, implies -p)
+    int  reorder = 0;                                        // Reorder the strokes of each line to shorten pen-up travel (-r)
+    float tolerance = 0.0f;                                  // Simplify strokes to this many mm (-t), 0 draws every font point
+    float arcTolerance = 0.0f;                               // Fit G2/G3 arcs within this many mm (-a), 0 for straight lines only
+    int  cacheGlyphs = 0;                                    // Send every glyph as a cached G91 fragment (-g)
+    float step = 0.0f;                                       // Coordinate grid in mm (-q), 0 keeps 3 decimals as they are
+    int  replyTimeout;                                       // Longest wait for the robot to answer in ms (-w)
+
+    for (int arg = 1; arg < argc; arg++)                     // Options replace the prompts for jobs run without a user
+    {
+        if (strcmp(argv[arg], "-s") == 0 && arg + 1 < argc && sscanf(argv[arg + 1], "%f", &FontSize) == 1)
+        {
+            haveFontSize = 1;
+            arg++;
+        }
+        else if (strcmp(argv[arg], "-i") == 0 && arg + 1 < argc)
+        {
+            inputPath = argv[++arg];
+        }
+        else if (strcmp(argv[arg], "-o") == 0 && arg + 1 < argc)
+        {
+            outputPath = argv[++arg];
+        }
+        else if (strcmp(argv[arg], "-c") == 0)
+        {
+            compact = 1;
+        }
+        else if (strcmp(argv[arg], "-p") == 0)
+        {
+            optimize = 1;
+        }
+        else if (strcmp(argv[arg], "-j") == 0 && arg + 1 < argc && sscanf(argv[arg + 1], "%f", &joinDistance) == 1 && joinDistance >= 0.0f)
+        {
+            optimize = 1;                                    // Gaps are found by the peephole pass
+            arg++;
+        }
+        else if (strcmp(argv[arg], "-g") == 0)
+        {
+            cacheGlyphs = 1;
+        }
+        else if (strcmp(argv[arg], "-r") == 0)
+        {
+            reorder = 1;
+        }
+        else if (strcmp(argv[arg], "-t") == 0 && arg + 1 < argc && sscanf(argv[arg + 1], "%f", &tolerance) == 1 && tolerance >= 0.0f)
+        {
+            arg++;
+        }
+        else if (strcmp(argv[arg], "-a") == 0 && arg + 1 < argc && sscanf(argv[arg + 1], "%f", &arcTolerance) == 1 && arcTolerance >= 0.0f)
+        {
+            arg++;
+        }
+        else if (strcmp(argv[arg], "-q") == 0 && arg + 1 < argc && sscanf(argv[arg + 1], "%f", &step) == 1 && step > 0.0f)
+        {
+            arg++;
+        }
+        else if (strcmp(argv[arg], "-w") == 0 && arg + 1 < argc && sscanf(argv[arg + 1], "%d", &replyTimeout) == 1 && replyTimeout > 0)
+        {
+            SetReplyTimeout(replyTimeout);
+            arg++;
+        }
+        else
+        {
+            printf("Usage: %s [-s font height in mm] [-i input text] [-o output.gcode] [-c] [-p] [-j gap in mm] [-r | -g] [-t tolerance in mm] [-a tolerance in mm] [-q step in mm] [-w timeout in ms]\n", argv[0]);
+            printf("With -o the G-code is written to the file and no robot is needed\n");
+            printf("-c leaves out repeated G0/G1 words, unchanged axes and redundant zeros\n");
+            printf("-p merges travels, drops moves that go nowhere and pen lifts that change nothing\n");
+            printf("-j keeps the pen down across pen-up gaps up to this length and draws through them (with -p)\n");
+            printf("-r draws the strokes of each line in an order with less pen-up travel\n");
+            printf("-g formats each glyph once per size as relative (G91) G-code and sends that copy every time\n");
+            printf("-t leaves out stroke points closer than the tolerance to a straight line, e.g. -t 0.05\n");
+            printf("-a draws runs of points on a circle as one G2/G3 arc, e.g. -a 0.05\n");
+            printf("-q rounds coordinates to a grid, e.g. -q 0.01 for two decimals\n");
+            printf("-w waits this long for the robot to answer before giving up (default %d ms)\n", REPLY_TIMEOUT_MS);
+            return 1;
+        }
+    }
+
+    if (cacheGlyphs && reorder)
     {
-        printf("Could not open InputText.txt\n");    // Print error message if file not found or inaccessible
+        printf("-g draws glyph by glyph and cannot be combined with -r\n");
+        return 1;
+    }
+
+    GcodeEmitter emitter;                                    // Formats every G-code line and passes it to SendCommands
+    if (InitGcodeEmitter(&emitter, SendCommands, compact, optimize, joinDistance, step) != 0)
+    {
+        printf("The -q step must be a multiple of 0.000001 mm\n");
+        return 1;
+    }
+
+    TextReader user_text;                            // Input text, memory-mapped and split into words without copying
+    if (OpenTextReader(inputPath, &user_text) != 0)  // Check if the file failed to open
+    {
+        printf("Could not open %s\n", inputPath);    // Print error message if file not found or inaccessible
         return 1;                                    // Exit program with error status code 1
     }
 
-    FILE *stroke_data = fopen("SingleStrokeFont.txt", "r"); // Open the font stroke data file in read mode
-    if (stroke_data == NULL)                                 // Check if the font file failed to open
+    FontTable font;                                          // Whole font held in memory once, indexed by ASCII code
+    if (LoadStrokeFont(&font) < 0)                           // Map the binary font, or parse the text font as a fallback
     {
-        printf("Could not open SingleStrokeFont.txt\n");     // Print error message
-        fclose(user_text);                                   // Close the user text file before exiting
+        CloseTextReader(&user_text);                         // Close the user text file before exiting
         return 1;                                            // Exit program with error status code 1
     }
 
-    float FontSize;                                          // Variable to store user-selected font height in mm
-    printf("Enter font height in mm (4-10): ");              // Prompt the user for a font height between 4 and 10 mm
-    if (scanf("%f", &FontSize) != 1)                         // Read the input
+    if (!haveFontSize)                                       // Not given on the command line
+    {
+        printf("Enter font height in mm (4-10): ");          // Prompt the user for a font height between 4 and 10 mm
+        haveFontSize = (scanf("%f", &FontSize) == 1);        // Read the input
+    }
+    if (!haveFontSize)
     {
         printf("Invalid font height input.\n");              // Print error if scanf fails to read a float
-        fclose(user_text);                                   // Close user text file
-        fclose(stroke_data);                                 // Close stroke data file
+        CloseTextReader(&user_text);                         // Close user text file
+        FreeFontTable(&font);                                // Release the loaded font
         return 1;                                            // Exit with error status code 1
     }
     if (FontSize < 4.0f)  FontSize = 4.0f;                   // Lower Limit for font height to minimum of 4 mm
     if (FontSize > 10.0f) FontSize = 10.0f;                  // Upper Limit for font height to maximum of 10 mm
 
-    char word[64];                                           // Buffer to hold a single word read from the text file
-    int  TextToAscii[64];                                    // Array to hold ASCII codes for characters in the word
+    WordView word;                                           // Current word: pointer into the input text plus its length
     int  word_count = 0;                                     // Counter to track how many words have been processed 
+    int  unknown_count = 0;                                  // Counter of characters skipped because the font has no glyph for them
+    unsigned long pointsTotal = 0;                           // Stroke points of every word drawn, before -t simplification
+    unsigned long pointsRemoved = 0;                         // Points -t left out
     
     float curX = 0.0f;                                       // Current X position (in mm) for placing the next character or word
     float curY = 0.0f;                                       // Current baseline Y position (in mm) for text
@@ -64,105 +170,322 @@ int main(void)
     float wordSpacing   = FontSize * 0.8f;                   // Word spacing (80%) to be larger than letter spacing
     char buffer[100];                                        // Character buffer used to format and send G-code strings
 
+    StrokeArena arena;                                       // Holds the glyph instances of the current word (or line, with -r) in one block
+    StrokeArenaInit(&arena);                                 // No memory is taken until the first word is loaded
+
+    StrokeOrder order;                                       // Pen position and travel totals of the reordered job
+    InitStrokeOrder(&order);
+    StrokeBuffer *lineWords = NULL;                          // With -r: stroke buffers of the words of the current line
+    int  nLineWords = 0;
+    int  lineCapacity = 0;
+
+    GlyphCache *glyphCache = NULL;                           // With -g: the G91 fragment of every glyph drawn so far
+    if (cacheGlyphs)
+    {
+        glyphCache = malloc(sizeof(GlyphCache));             // Too large for the stack
+        if (glyphCache == NULL)
+        {
+            printf("Out of memory for the glyph cache\n");
+            CloseTextReader(&user_text);                     // Close user text file
+            FreeFontTable(&font);                            // Release the loaded font
+            return 1;                                        // Exit with error status code 1
+        }
+        InitGlyphCache(glyphCache, tolerance, arcTolerance);
+    }
+
     printf("Letter spacing: %.1fmm | Word spacing: %.1fmm\n", // Print computed spacing values for code checking (not necessary)
            letterSpacing, wordSpacing);
 
-    if (CanRS232PortBeOpened() == -1)                        // Attempt to open the serial COM port 
+    GcodeWriter gcodeFile;                                   // Output file of an offline job
+    if (outputPath != NULL)
+    {
+        if (OpenGcodeWriter(outputPath, &gcodeFile) != 0)    // Create the .gcode file instead of opening the COM port
+        {
+            printf("Could not create %s\n", outputPath);
+            CloseTextReader(&user_text);                     // Close user text file
+            FreeFontTable(&font);                            // Release the loaded font
+            return 1;                                        // Exit with error status code 1
+        }
+        gcodeOutput = &gcodeFile;                            // Every command from here on goes to the file
+    }
+    else if (CanRS232PortBeOpened() == -1)                   // Attempt to open the serial COM port 
     {
         printf("Unable to open COM port\n");                 // Print error if COM port cannot be opened
-        fclose(user_text);                                   // Close user text file
-        fclose(stroke_data);                                 // Close stroke data file
+        CloseTextReader(&user_text);                         // Close user text file
+        FreeFontTable(&font);                                // Release the loaded font
         exit(0);                                             // Exit the program immediately
     }
+    else
+    {
+        printf("\nAbout to wake up the robot\n");            // Inform the user that the wake-up sequence is starting
+        sprintf(buffer, "\n");                               // Put a newline character into the buffer (wake-up signal)
+        PrintBuffer(&buffer[0]);                             // Send the newline over serial using provided function
+        if (WaitForDollar() != 0)                            // Block until a '$' character is received from the robot
+        {
+            printf("The robot did not wake up\n");           // Nothing was received before the reply timeout
+            CloseRS232Port();                                // Close the serial COM port
+            CloseTextReader(&user_text);                     // Close user text file
+            FreeFontTable(&font);                            // Release the loaded font
+            return 1;                                        // Exit with error status code 1
+        }
+        printf("\nThe robot is now ready to draw\n");        // Inform user that robot is ready to receive G-code
 
-    printf("\nAbout to wake up the robot\n");                // Inform the user that the wake-up sequence is starting
-    sprintf(buffer, "\n");                                   // Put a newline character into the buffer (wake-up signal)
-    PrintBuffer(&buffer[0]);                                 // Send the newline over serial using provided function
-    Sleep(100);                                              // Wait 100 ms to allow the robot to process the wake-up signal
-    WaitForDollar();                                         // Block until a '$' character is received from the robot
-    printf("\nThe robot is now ready to draw\n");            // Inform user that robot is ready to receive G-code
+        if (StartCommandSender() != 0)                       // Stream to the robot from its own thread while G-code is generated here
+        {
+            printf("Could not start the sender thread - sending directly\n");
+        }
+    }
 
-    sprintf(buffer, "G1 X0 Y0 F1000\n");                     // Prepare G-code to move to (0,0) with feedrate 1000
-    SendCommands(buffer);                                    // Send this G-code line to the robot
+    EmitGcode(&emitter, "G1 X0 Y0 F1000\n");                 // Send G-code to move to (0,0) with feedrate 1000
 
-    sprintf(buffer, "M3\n");                                 // Prepare G-code M3 (pen enable command)
-    SendCommands(buffer);                                    // Send the M3 command to the robot
+    EmitGcode(&emitter, "M3\n");                             // Send the M3 command (pen enable command) to the robot
 
-    sprintf(buffer, "S0\n");                                 // Prepare G-code S0 (set pen to pen up position)
-    SendCommands(buffer);                                    // Send the S0 command to the robot
+    EmitGcode(&emitter, "S0\n");                             // Send the S0 command (set pen to pen up position) to the robot
 
-    while (TexttoWordArray(user_text, word, sizeof(word)))  // Loop while a new word is read from the input text file
+    while (TexttoWordArray(&user_text, &word))              // Loop while a new word is found in the input text
     {
         word_count++;                                       // Increment the word counter for each successfully read word
-        if (word[0] == '\0')                                // Check if the word buffer is empty 
+        int wordLength = (int)word.length;                  // Words have no length limit, arrays are sized per word
+
+        GlyphInstance *chars = StrokeArenaAlloc(&arena, word.length * sizeof(GlyphInstance)); // One glyph reference plus placement per character
+        if (chars == NULL)                                  // Check if the arena could not provide the memory
         {
-            printf("Error: Word buffer is empty. Check if text file has words\n"); // Print error message if buffer is empty
-            break;                                          // Exit the word-processing loop
+            printf("Out of memory for: %.*s\n", wordLength, word.start); // Inform user that the word could not be processed
+            break;                                          // Exit the processing loop
         }
 
-        StrokeData chars[64];                               // Array of StrokeData structures to hold strokes for up to 64 characters in this word
+        int nChars = ExtractStrokeData(word.start, wordLength, word.offset, &font, chars, &unknown_count); // Input bytes straight to glyph references
 
-        int len = WordArraytoASCII(word, TextToAscii, 64);  // Convert the current word into ASCII codes, store count in len
+        if (ScaleandAdjustStrokeData(chars, nChars, FontSize, &curX, &curY, 100.0f, 50.0f) < 0) // Scale and position glyphs within 100x50 mm area
+        {
+            printf("Drawing area is full - remaining text not drawn\n"); // Every following word would be below the area too
+            word_count--;                                   // This word was not drawn
+            break;                                          // Exit the processing loop
+        }
 
-        int valid = 1;                                      // Indicate if ASCII conversion matches original characters
-        for (int j = 0; j < len; j++)                       // Loop over each character index in the word
+        if (glyphCache != NULL)                             // Each glyph is sent as its pre-formatted G91 fragment
         {
-            if ((char)TextToAscii[j] != word[j])            // Compare original character with converted ASCII back to char
+            if (DrawWordCached(glyphCache, chars, nChars, &arena, &emitter) < 0)
             {
-                valid = 0;                                  // Mark as invalid if there is a mismatch
-                break;                                      // Stop checking further characters
+                printf("Out of memory for: %.*s\n", wordLength, word.start); // Inform user that the word could not be processed
+                break;                                      // Exit the processing loop
             }
         }
-        if (!valid)                                         // If ASCII conversion was invalid
+        else
         {
-            printf("ASCII conversion failed for: %s\n", word); // Print error with the problematic word
-            break;                                          // Exit the processing loop
+            StrokeBuffer strokes;                           // Page coordinates of every stroke point in this word
+            if (TransformStrokes(chars, nChars, &arena, &strokes) < 0) // Apply each glyph's placement to its points in one pass
+            {
+                printf("Out of memory for: %.*s\n", wordLength, word.start); // Inform user that the word could not be processed
+                break;                                      // Exit the processing loop
+            }
+
+            if (tolerance > 0.0f)                           // Straighten runs of (nearly) collinear points
+            {
+                pointsTotal += (unsigned long)strokes.nPoints;
+                int removed = SimplifyStrokes(&strokes, tolerance, &arena);
+                if (removed > 0) pointsRemoved += (unsigned long)removed;   // Out of memory: the word is drawn unsimplified
+            }
+
+            if (reorder)                                    // Keep the word until its line is complete
+            {
+                if (nLineWords == lineCapacity)
+                {
+                    int newCapacity = lineCapacity ? 2 * lineCapacity : 16;
+                    StrokeBuffer *grown = realloc(lineWords, (size_t)newCapacity * sizeof(StrokeBuffer));
+                    if (grown == NULL)
+                    {
+                        printf("Out of memory for: %.*s\n", wordLength, word.start);
+                        break;                              // Exit the processing loop
+                    }
+                    lineWords = grown;
+                    lineCapacity = newCapacity;
+                }
+                lineWords[nLineWords++] = strokes;          // Its points stay in the arena until the line is drawn
+            }
+            else
+            {
+                ConvertStrokestoGcode(&strokes, &emitter, arcTolerance); // Convert positioned stroke data into G-code and send to robot
+            }
         }
 
-        int nChars = ExtractStrokeData(TextToAscii, len, stroke_data, chars, 64); // Load stroke data for each ASCII code into chars array
-        if (nChars < 0)                                     // Check if stroke loading failed
+        if (CommandSenderFailed())                          // The robot stopped answering part way through the word
         {
-            printf("Stroke data missing for: %s\n", word);  // Inform user that stroke data was not found 
+            printf("Robot stopped responding - drawing abandoned\n");
             break;                                          // Exit the processing loop
         }
 
-        ScaleandAdjustStrokeData(chars, nChars, FontSize, &curX, &curY, 100.0f, 50.0f); // Scale and position strokes within 100x50 mm area
-
-        ConvertStrokestoGcode(chars, nChars, buffer);                   // Convert positioned stroke data into G-code and send to robot
-
         curX += wordSpacing;                                // After finishing this word, advance X position by adding wordspacing value
 
+        int lineDone = 0;                                   // Set when the next word starts a new line
         if (curX > 95.0f)                                   // If current X exceeds 95 mm (getting close to end of allowed space)
         {
             printf("Word wrap at X=%.1fmm\n", curX);        // Print message indicating text wrapping will happen
             curX = 0.0f;                                    // Reset X position to the left
             curY -= (FontSize + 5.0f);                      // Move Y down by font height plus 5 mm line spacing
+            lineDone = 1;
         }
 
-        for (int i = 0; i < nChars; i++)                    // Loop over each StrokeData structure in chars array
+        if (reorder && !lineDone)
         {
-            FreeStrokeData(&chars[i]);                      // Free dynamically allocated memory (X, Y, Z arrays) for each character
+            continue;                                       // The arena keeps collecting the line
         }
+        if (reorder)
+        {
+            int drawn = DrawLine(&order, lineWords, nLineWords, &arena, &emitter, arcTolerance);
+            nLineWords = 0;                                 // DrawLine has released the line's memory
+            if (drawn < 0)
+            {
+                printf("Out of memory for the line ending with: %.*s\n", wordLength, word.start);
+                break;                                      // Exit the processing loop
+            }
+            if (CommandSenderFailed())
+            {
+                printf("Robot stopped responding - drawing abandoned\n");
+                break;                                      // Exit the processing loop
+            }
+        }
+
+        StrokeArenaReset(&arena);                           // Release the glyph instances and stroke buffer of this word at once
     }
 
-    sprintf(buffer, "S0\n");                                // Final S0 command to ensure pen is up at the end
-    SendCommands(buffer);                                   // Send the final S0 command to the robot
+    if (nLineWords > 0 && !CommandSenderFailed())          // Words of the last line, or of the line the loop stopped in
+    {
+        if (DrawLine(&order, lineWords, nLineWords, &arena, &emitter, arcTolerance) < 0)
+        {
+            printf("Out of memory for the last line\n");
+        }
+    }
+    free(lineWords);
+
+    if (glyphCache != NULL)
+    {
+        EmitGcode(&emitter, "G90\n");                       // Leave the controller in absolute mode after the last fragment
+    }
+    EmitGcode(&emitter, "S0\n");                            // Final S0 command to ensure pen is up at the end, always sent
+    if (compact || optimize || arcTolerance > 0.0f || step > 0.0f) // Show what the shorter G-code saved
+    {
+        ReportGcodeStats(&emitter);
+    }
+    if (tolerance > 0.0f)                                   // Show how many points simplification saved
+    {
+        if (glyphCache != NULL)                             // With -g each glyph was simplified inside the cache
+        {
+            pointsTotal += glyphCache->pointsTotal;
+            pointsRemoved += glyphCache->pointsRemoved;
+        }
+        printf("Simplified strokes: %lu of %lu points left out (tolerance %.3f mm)\n", pointsRemoved, pointsTotal, tolerance);
+    }
+    if (glyphCache != NULL)                                 // Show how often a cached glyph was reused
+    {
+        ReportGlyphCache(glyphCache);
+        FreeGlyphCache(glyphCache);
+        free(glyphCache);
+    }
+    if (reorder)                                            // Show the pen-up travel reordering saved
+    {
+        ReportStrokeOrder(&order);
+    }
+
+    int status = 0;                                         // Program exit status
+    if (gcodeOutput != NULL)                                // Offline job: finish the file
+    {
+        if (CloseGcodeWriter(&gcodeFile) != 0)
+        {
+            printf("Could not write all of %s\n", outputPath);
+            status = 1;
+        }
+        printf("Wrote %lu lines (%llu bytes) to %s\n", gcodeFile.lines, gcodeFile.bytes, outputPath);
+    }
+    else
+    {
+        int rejected = StopCommandSender();                 // Wait until the robot has accepted every queued line
+        if (rejected < 0)                                   // The last lines were never acknowledged
+        {
+            printf("Robot stopped responding before the drawing finished\n");
+            status = 1;
+        }
+        else if (rejected > 0)                              // Report lines the robot answered with an error
+        {
+            printf("Robot rejected %d G-code lines\n", rejected);
+            status = 1;
+        }
+        ReportTransmitStats();                              // Commands, bytes and write calls of the job
+    }
 
     printf("\nDrew %d words | Final position: X=%.1f Y=%.1f\n", // Print summary of drawing operation (not necessary just for clarity)
            word_count, curX, curY);
+    if (unknown_count > 0)                                  // Report characters that could not be drawn
+    {
+        printf("Skipped %d characters with no stroke data\n", unknown_count);
+    }
 
-    fclose(user_text);                                      // Close the input text file
-    fclose(stroke_data);                                    // Close the font data file
+    CloseTextReader(&user_text);                            // Close the input text file
+    FreeFontTable(&font);                                   // Release the loaded font
+    StrokeArenaFree(&arena);                                // Return the word arena's memory
 
-    CloseRS232Port();                                       // Close the serial COM port
-    printf("Com port closed\n");                            // Confirm to the user that the COM port has been closed
-    return 0;                                               // Return 0 to indicate successful program termination
+    if (gcodeOutput == NULL)
+    {
+        CloseRS232Port();                                   // Close the serial COM port
+        printf("Com port closed\n");                        // Confirm to the user that the COM port has been closed
+    }
+    return status;                                          // 0 when the whole drawing was written or accepted
 }
 
 // Function to send one G-code command to the robot
+// Lines are queued for the sender thread, StopCommandSender waits for the last acknowledgements
+// In an offline job they are appended to the .gcode file instead
 void SendCommands(char *buffer)
 {
-    PrintBuffer(&buffer[0]);                                // Use provided PrintBuffer to send the string over serial
-    WaitForReply();                                         // Block until the robot acknowledges the command
-    Sleep(100);                                             // Wait for 100 ms to give robot time before next command
+    if (gcodeOutput != NULL)
+    {
+        WriteGcode(gcodeOutput, buffer, strlen(buffer));    // Buffered, the file is written in large blocks
+        return;
+    }
+    QueueCommand(&buffer[0]);                               // Hand the line to the sender thread, waits only while its queue is full
+}
+
+// Function to draw one line of text collected with -r
+// Splits the line into pen-down polylines, puts them in an order with less pen-up travel and converts them to G-code.
+// A line ends at a word wrap; a word that ScaleandAdjustStrokeData moves to the next line by itself stays with
+// the group, which only gives the optimizer a larger area to work on.
+// Returns: number of points drawn, -1 if the arena ran out of memory (nothing of the line is drawn)
+static int DrawLine(StrokeOrder *order, const StrokeBuffer *lineWords, int nLineWords, StrokeArena *arena, GcodeEmitter *emitter, float arcTolerance)
+{
+    StrokeBuffer line;                                      // The whole line in its new order
+    int nPoints = OrderStrokes(order, lineWords, nLineWords, arena, &line);
+
+    if (nPoints >= 0)
+    {
+        ConvertStrokestoGcode(&line, emitter, arcTolerance); // Same conversion as for a single word
+    }
+    StrokeArenaReset(arena);                                // Release every word of the line at once
+    return nPoints;
+}
+
+// Function to load the stroke font used for every word
+// Prefers the memory-mapped binary font made by tools/MakeBinaryFont (no parsing, no per-glyph allocation),
+// then the text font, and uses the font compiled into the program when neither file is in the working directory
+// Returns: number of glyphs loaded, -1 if a font file exists but could not be read
+int LoadStrokeFont(FontTable *font)
+{
+    int nGlyphs = LoadFontBinary("SingleStrokeFont.bin", font);  // Try the binary font first
+    if (nGlyphs >= 0)
+    {
+        return nGlyphs;                                     // Font is mapped straight from the file
+    }
+
+    FILE *stroke_data = fopen("SingleStrokeFont.txt", "r"); // Open the font stroke data file in read mode
+    if (stroke_data == NULL)                                // No font file next to the program
+    {
+        return LoadFontEmbedded(font);                      // Use the built-in copy of SingleStrokeFont.txt
+    }
+
+    nGlyphs = LoadFontTable(stroke_data, font);             // Parse every glyph of the font file in a single pass
+    fclose(stroke_data);                                    // Font file is no longer needed once it is in memory
+    if (nGlyphs < 0)                                        // Check if the font file could not be parsed
+    {
+        printf("Could not read SingleStrokeFont.txt\n");    // Print error message
+    }
+    return nGlyphs;
 }
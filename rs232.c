@@ -287,6 +287,10 @@ int RS232_OpenComport(int comport_number, int baudrate, const char *mode)
 
     if(ioctl(Cport[comport_number], TIOCMGET, &status) == -1)
     {
+        if((errno == ENOTTY) || (errno == EINVAL))
+        {
+            return(0);  /* pseudo-terminal: there are no modem control lines to set */
+        }
         tcsetattr(Cport[comport_number], TCSANOW, old_port_settings + comport_number);
         flock(Cport[comport_number], LOCK_UN);  /* free the port so that others can use it. */
         perror("unable to get portstatus");
@@ -324,6 +328,47 @@ int RS232_PollComport(int comport_number, unsigned char *buf, int size)
 }
 
 
+/* waits up to timeout_ms milliseconds for data, then reads what has arrived */
+/* returns the number of bytes read, 0 on timeout, -1 on error or hang-up */
+int RS232_PollComportTimeout(int comport_number, unsigned char *buf, int size, int timeout_ms)
+{
+    struct pollfd pfd;
+    int n;
+
+    pfd.fd = Cport[comport_number];
+    pfd.events = POLLIN;
+
+    do
+    {
+        pfd.revents = 0;
+        n = poll(&pfd, 1, timeout_ms);
+    }
+    while((n < 0) && (errno == EINTR));
+
+    if(n < 0)
+        return(-1);
+
+    if(n == 0)
+        return(0);   /* nothing arrived in time */
+
+    if(!(pfd.revents & POLLIN))
+        return(-1);  /* POLLHUP or POLLERR without data */
+
+    n = read(Cport[comport_number], buf, size);
+
+    if(n == 0)
+        return(-1);  /* end of file: the other side went away */
+
+    if(n < 0)
+    {
+        if(errno == EAGAIN)
+            return 0;
+    }
+
+    return(n);
+}
+
+
 int RS232_SendByte(int comport_number, unsigned char byte)
 {
     int n = write(Cport[comport_number], &byte, 1);
@@ -348,7 +393,7 @@ int RS232_SendBuf(int comport_number, unsigned char *buf, int size)
     int n = write(Cport[comport_number], buf, size);
     if(n < 0)
     {
-        if(errno == EAGAIN)
+        if((errno == EAGAIN) || (errno == EINTR))
         {
             return 0;
         }
@@ -362,21 +407,50 @@ int RS232_SendBuf(int comport_number, unsigned char *buf, int size)
 }
 
 
+/* waits up to timeout_ms milliseconds until the port accepts more data */
+/* returns 1 when it does, 0 on timeout, -1 on error */
+int RS232_WaitComportWritable(int comport_number, int timeout_ms)
+{
+    struct pollfd pfd;
+    int n;
+
+    pfd.fd = Cport[comport_number];
+    pfd.events = POLLOUT;
+
+    do
+    {
+        pfd.revents = 0;
+        n = poll(&pfd, 1, timeout_ms);
+    }
+    while((n < 0) && (errno == EINTR));
+
+    if(n <= 0)
+        return(n);
+
+    return (pfd.revents & POLLOUT) ? 1 : -1;
+}
+
+
 void RS232_CloseComport(int comport_number)
 {
     int status;
 
     if(ioctl(Cport[comport_number], TIOCMGET, &status) == -1)
     {
-        perror("unable to get portstatus");
+        if((errno != ENOTTY) && (errno != EINVAL))  /* a pseudo-terminal has no modem control lines */
+        {
+            perror("unable to get portstatus");
+        }
     }
-
-    status &= ~TIOCM_DTR;    /* turn off DTR */
-    status &= ~TIOCM_RTS;    /* turn off RTS */
-
-    if(ioctl(Cport[comport_number], TIOCMSET, &status) == -1)
+    else
     {
-        perror("unable to set portstatus");
+        status &= ~TIOCM_DTR;    /* turn off DTR */
+        status &= ~TIOCM_RTS;    /* turn off RTS */
+
+        if(ioctl(Cport[comport_number], TIOCMSET, &status) == -1)
+        {
+            perror("unable to set portstatus");
+        }
     }
 
     tcsetattr(Cport[comport_number], TCSANOW, old_port_settings + comport_number);
@@ -740,6 +814,39 @@ int RS232_PollComport(int comport_number, unsigned char *buf, int size)
 }
 
 
+/* waits up to timeout_ms milliseconds for data, then reads what has arrived */
+/* returns the number of bytes read, 0 on timeout, -1 on error */
+int RS232_PollComportTimeout(int comport_number, unsigned char *buf, int size, int timeout_ms)
+{
+    DWORD n = 0;
+    int result;
+
+    COMMTIMEOUTS Cptimeouts;
+
+    /* ReadFile returns as soon as one byte is received, or after timeout_ms without any */
+    Cptimeouts.ReadIntervalTimeout         = MAXDWORD;
+    Cptimeouts.ReadTotalTimeoutMultiplier  = MAXDWORD;
+    Cptimeouts.ReadTotalTimeoutConstant    = timeout_ms;
+    Cptimeouts.WriteTotalTimeoutMultiplier = 0;
+    Cptimeouts.WriteTotalTimeoutConstant   = 0;
+
+    if(!SetCommTimeouts(Cport[comport_number], &Cptimeouts))
+    {
+        return(-1);
+    }
+
+    result = ReadFile(Cport[comport_number], buf, size, &n, NULL) ? (int)n : -1;
+
+    /* back to the non-blocking reads RS232_PollComport expects */
+    Cptimeouts.ReadTotalTimeoutMultiplier  = 0;
+    Cptimeouts.ReadTotalTimeoutConstant    = 0;
+
+    SetCommTimeouts(Cport[comport_number], &Cptimeouts);
+
+    return(result);
+}
+
+
 int RS232_SendByte(int comport_number, unsigned char byte)
 {
     int n;
@@ -766,6 +873,16 @@ int RS232_SendBuf(int comport_number, unsigned char *buf, int size)
 }
 
 
+/* WriteFile blocks until the data is queued, so the port is always ready for the next write */
+int RS232_WaitComportWritable(int comport_number, int timeout_ms)
+{
+    (void)comport_number;
+    (void)timeout_ms;
+
+    return(1);
+}
+
+
 void RS232_CloseComport(int comport_number)
 {
     CloseHandle(Cport[comport_number]);
@@ -870,6 +987,36 @@ void RS232_cputs(int comport_number, const char *text)  /* sends a string to ser
 }
 
 
+/* use devname instead of the built-in device name for comport_number, e.g. a USB adapter or */
+/* the pseudo-terminal of a simulator; call before RS232_OpenComport */
+/* returns 0, or -1 for an illegal comport number or a name that is too long */
+int RS232_SetPortName(int comport_number, const char *devname)
+{
+    static char names[RS232_PORTNR][64];
+
+    if((comport_number>=RS232_PORTNR)||(comport_number<0)||(strlen(devname)>=50))
+    {
+        return(-1);
+    }
+
+#if defined(__linux__) || defined(__FreeBSD__)   /* Linux & FreeBSD */
+    if(devname[0] == '/')
+        strcpy(names[comport_number], devname);
+    else
+        sprintf(names[comport_number], "/dev/%s", devname);
+#else  /* windows */
+    if(devname[0] == '\\')
+        strcpy(names[comport_number], devname);
+    else
+        sprintf(names[comport_number], "\\\\.\\%s", devname);
+#endif
+
+    comports[comport_number] = names[comport_number];
+
+    return(0);
+}
+
+
 /* return index in comports matching to device name or -1 if not found */
 int RS232_GetPortnr(const char *devname)
 {
@@ -53,6 +53,7 @@ extern "C" {
 #include <limits.h>
 #include <sys/file.h>
 #include <errno.h>
+#include <poll.h>
 
 #else
 
@@ -62,8 +63,10 @@ extern "C" {
 
 int RS232_OpenComport(int, int, const char *);
 int RS232_PollComport(int, unsigned char *, int);
+int RS232_PollComportTimeout(int, unsigned char *, int, int);
 int RS232_SendByte(int, unsigned char);
 int RS232_SendBuf(int, unsigned char *, int);
+int RS232_WaitComportWritable(int, int);
 void RS232_CloseComport(int);
 void RS232_cputs(int, const char *);
 int RS232_IsDCDEnabled(int);
@@ -77,6 +80,7 @@ void RS232_flushRX(int);
 void RS232_flushTX(int);
 void RS232_flushRXTX(int);
 int RS232_GetPortnr(const char *);
+int RS232_SetPortName(int, const char *);
 
 #ifdef __cplusplus
 } /* extern "C" */
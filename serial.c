@@ -2,17 +2,42 @@
 #include <stdlib.h>
 
 #include "serial.h"
-//#include "rs232.h"
+#include "GrblResponse.h"
+#include "rs232.h"
 
 
 //#define Serial_Mode
 
+static int replyTimeout = REPLY_TIMEOUT_MS;     // Longest wait for the robot to answer, in ms
+
+static unsigned long txCommands = 0;            // Commands streamed to the robot
+static unsigned long txBytes = 0;               // Bytes in those commands
+static unsigned long txWrites = 0;              // Write calls made to send them
+
+// Change how long to wait for the robot before giving up on it
+void SetReplyTimeout (int milliseconds)
+{
+    replyTimeout = milliseconds;
+}
+
 #ifdef Serial_Mode
 
+#define STARTUP_QUIET_MS    100                 // Silence that ends the start-up replies
+
+static GrblResponse response;                   // Received text not yet split into reply lines
+
 // Open port with checking
 int CanRS232PortBeOpened ( void )
 {
     char mode[]= {'8','N','1',0};
+    const char *port = getenv("GRBL_PORT");      // Device to use instead of COM number cport_nr, e.g. tools/GrblSimulator's
+    GrblResponseInit(&response);
+    if( (port != NULL) && (RS232_SetPortName(cport_nr, port) != 0) )
+    {
+        printf("Invalid GRBL_PORT: %s\n", port);
+
+        return(-1);
+    }
     if(RS232_OpenComport(cport_nr, bdrate, mode))
     {
         printf("Can not open comport\n");
@@ -28,55 +53,147 @@ void CloseRS232Port (void)
     RS232_CloseComport(cport_nr);
 }
 
+static unsigned char txBuffer[GRBL_RX_BUFFER_SIZE];    // Streamed commands waiting to go out in one write
+static int txLength = 0;                        // Bytes waiting in txBuffer
+
+// Write bytes to the port, carrying on after partial writes
+// The port is non-blocking, so a full kernel transmit buffer shows up as a write of 0 bytes (EAGAIN);
+// then wait until the port can take more instead of dropping the rest
+// Returns: 0 when every byte was written, -1 if the port failed or stayed full for replyTimeout
+static int WritePort (const unsigned char *data, int length)
+{
+    while (length > 0)
+    {
+        int n = RS232_SendBuf(cport_nr, (unsigned char *)data, length);
+        txWrites++;
+
+        if (n < 0)
+        {
+            printf("Writing to the COM port failed\n");
+            return (-1);
+        }
+
+        if (n == 0)
+        {
+            if (RS232_WaitComportWritable(cport_nr, replyTimeout) <= 0)
+            {
+                printf("COM port stopped accepting data\n");
+                return (-1);
+            }
+            continue;
+        }
+
+        data += n;
+        length -= n;
+    }
+    return (0);
+}
+
 // Write text out via the serial port
 int PrintBuffer (char *buffer)
 {
-    RS232_cputs(cport_nr, buffer);
+    if (WritePort((unsigned char *)buffer, (int)strlen(buffer)) != 0)
+        return (-1);
     printf("sent: %s\n", buffer);
 
     return (0);
 
 }
 
+// Add a streamed command to the transmit buffer, it goes out with the next FlushTransmit
+static int TransmitCommand (const char *buffer, int length)
+{
+    if ( (txLength + length > (int)sizeof(txBuffer)) && (FlushTransmit() != 0) )
+        return (-1);
 
-int WaitForDollar (void)
+    memcpy(txBuffer + txLength, buffer, length);
+    txLength += length;
+    return (0);
+}
+
+// Write every buffered command to the port in a single write where possible
+// Returns: 0 on success, -1 if the port failed
+int FlushTransmit (void)
 {
+    int result = 0;
 
+    if (txLength > 0)
+    {
+        result = WritePort(txBuffer, txLength);
+        txLength = 0;
+    }
+    return (result);
+}
 
-    int i, n;
 
-    unsigned char buf[4096];
+// Block until the robot sends something, for at most replyTimeout milliseconds
+// poll() wakes up as soon as the first byte arrives instead of on the next 100 ms tick
+// Returns: number of bytes read, -1 on timeout or a failed port
+static int ReadReply (unsigned char *buf, int size)
+{
+    int n = RS232_PollComportTimeout(cport_nr, buf, size, replyTimeout);
 
-    while(1)
+    if (n == 0)
+        printf("No reply from the robot within %d ms\n", replyTimeout);
+    else if (n < 0)
+        printf("Reading from the COM port failed\n");
+
+    return (n > 0) ? n : -1;
+}
+
+
+// GRBL answers the wake-up newline with "ok" as well as sending its banner, in either order. Neither
+// answers a streamed line, so everything that arrives until the port has been quiet for a moment is dropped.
+static void DiscardStartupReplies (void)
+{
+    GrblReply reply;
+    unsigned char buf[256];
+    int n;
+
+    while ( (n = RS232_PollComportTimeout(cport_nr, buf, sizeof(buf), STARTUP_QUIET_MS)) > 0 )
     {
-        printf (".");
-        n = RS232_PollComport(cport_nr, buf, 4095);
+        GrblResponseFeed(&response, buf, n);
+        while (GrblResponseNext(&response, &reply))
+        {
+            if (reply.type != GRBL_REPLY_OK)
+                printf("received: %s\n", reply.text);
+        }
+    }
+    GrblResponseInit(&response);                // Streaming starts with an empty receive ring
+}
+
 
-        if(n > 0)
+int WaitForDollar (void)
+{
+    GrblReply reply;
+    unsigned char buf[256];
+    int n;
+
+    while(1)
+    {
+        while (GrblResponseNext(&response, &reply))
         {
-            printf ("RCVD: N = %d ", n);
-            buf[n] = 0;   /* always put a "null" at the end of a string! */
+            printf("received: %s\n", reply.text);
 
-            for(i=0; i < n; i++)
+            if (reply.type == GRBL_REPLY_BANNER || strchr(reply.text, '$') != NULL)   // Any line with a '$', as the start-up check always did
             {
-                if(buf[i] == '$')  /* replace unreadable control-codes by dots */
-                {
-                    printf("received %i bytes: %s \n", n, (char *)buf);
-                    printf("\nSaw the Dollar");
-                    return 0;
-                }
+                printf("\nSaw the Dollar");
+                DiscardStartupReplies();
+                return 0;
             }
 
-            printf("received %i bytes: %s \n", n, (char *)buf);
-
-
-            if ( (buf[0] == 'o') && (buf[1] == 'k') )
+            if (reply.type == GRBL_REPLY_OK)
+            {
+                DiscardStartupReplies();
                 return 0;
+            }
         }
 
+        n = ReadReply(buf, sizeof(buf));
+        if(n < 0)
+            return(-1);
 
-        Sleep(100);
-
+        GrblResponseFeed(&response, buf, n);
     }
 
     return(0);
@@ -84,42 +201,51 @@ int WaitForDollar (void)
 }
 
 
-int WaitForReply (void)
+// Wait for the controller to answer one or more streamed lines
+// Every "ok" or "error" line answers exactly one sent line, in the order the lines were sent
+// Replies are taken line by line from the receive ring, so an "ok" split over two reads is still seen
+// and answers beyond maxReplies stay queued for the next call
+// Inputs: replies - filled with 0 for "ok" or the error number (-1 if none given) for "error"
+//         maxReplies - number of lines still waiting for an answer
+// Returns: number of replies stored, -1 if the robot stopped answering
+int WaitForReply (int *replies, int maxReplies)
 {
-
-
-    int i, n;
-
-    unsigned char buf[4096];
+    GrblReply reply;
+    unsigned char buf[256];
+    int n, count = 0;
 
     while(1)
     {
-        printf (".");
-        n = RS232_PollComport(cport_nr, buf, 4095);
-
-        if(n > 0)
+        while ( (count < maxReplies) && GrblResponseNext(&response, &reply) )
         {
-            printf ("RCVD: N = %d ", n);
-            buf[n] = 0;   /* always put a "null" at the end of a string! */
-
-            for(i=0; i < n; i++)
+            switch (reply.type)
             {
-                if(buf[i] < 32)  /* replace unreadable control-codes by dots */
-                {
-                    buf[i] = '.';
-                }
+            case GRBL_REPLY_OK:
+                replies[count++] = 0;
+                break;
+            case GRBL_REPLY_ERROR:
+                replies[count++] = reply.code;
+                break;
+            case GRBL_REPLY_ALARM:
+                printf("Robot alarm %d - moves are refused until it is unlocked\n", reply.code);
+                break;
+            case GRBL_REPLY_BANNER:
+                printf("Robot was reset - lines in its buffer were lost\n");
+                break;
+            default:                            // Status reports and messages need no answer
+                printf("received: %s\n", reply.text);
+                break;
             }
-
-            printf("received %i bytes: %s\n", n, (char *)buf);
-
-
-            if ( (buf[0] == 'o') && (buf[1] == 'k') )
-                return 0;
         }
 
+        if (count > 0)
+            return count;
 
-        Sleep(100);
+        n = ReadReply(buf, sizeof(buf));
+        if(n < 0)
+            return(-1);
 
+        GrblResponseFeed(&response, buf, n);
     }
 
     return(0);
@@ -150,12 +276,27 @@ int PrintBuffer (char *buffer)
     return (0);
 }
 
+// Without a robot every command is printed on its own
+static int TransmitCommand (const char *buffer, int length)
+{
+    (void)length;
+    txWrites++;
+    return PrintBuffer((char *)buffer);
+}
+
+int FlushTransmit (void)
+{
+    return (0);
+}
+
 
-int WaitForReply (void)
+// Without a robot every key press stands for one "ok"
+int WaitForReply (int *replies, int maxReplies)
 {
     char c;
     c = getchar();
-    return (0);
+    replies[0] = 0;
+    return (maxReplies > 0);
 }
 
 int WaitForDollar (void)
@@ -169,5 +310,121 @@ int WaitForDollar (void)
 #endif // SM
 
 
+// Character-counting streamer
+// GRBL acknowledges each line once it has been taken out of its 128 byte receive buffer, so lines
+// can be sent ahead for as long as the bytes of all unacknowledged lines still fit in that buffer.
+// This keeps the planner fed instead of leaving the robot idle for one round trip per line.
+static char streamLine[STREAM_MAX_LINES][GRBL_RX_BUFFER_SIZE + 1];   // Copy of each unacknowledged line, for error reports
+static int  streamLength[STREAM_MAX_LINES];     // Bytes each unacknowledged line takes in the receive buffer
+static int  streamHead  = 0;                    // Slot of the oldest unacknowledged line
+static int  streamCount = 0;                    // Lines sent but not yet acknowledged
+static int  streamBytes = 0;                    // Bytes sent but not yet acknowledged
+static int  streamErrors = 0;                   // Lines the controller answered with "error"
+static int  streamFailed = 0;                   // Set once the robot stopped answering
+
+// Match the next replies from the controller to the oldest unacknowledged lines
+static int CollectReplies (void)
+{
+    int replies[STREAM_MAX_LINES];
+    int i, n;
+
+    if (FlushTransmit() != 0)                   // Lines still in the transmit buffer cannot be answered
+    {
+        streamFailed = 1;
+        return (-1);
+    }
+
+    n = WaitForReply(replies, streamCount);
+    if (n < 0)
+    {
+        streamFailed = 1;                       // Nothing more can be sent to a robot that does not answer
+        return n;
+    }
+    for(i = 0; i < n; i++)
+    {
+        if (replies[i] != 0)
+        {
+            printf("Controller rejected \"%s\" (error %d)\n", streamLine[streamHead], replies[i]);
+            streamErrors++;
+        }
+        streamBytes -= streamLength[streamHead];
+        streamHead = (streamHead + 1) % STREAM_MAX_LINES;
+        streamCount--;
+    }
+    return n;
+}
+
+// Send one line, first waiting for acknowledgements only while the controller has no room for it
+// Returns: 0 on success, -1 if the line can never fit in the receive buffer or the robot stopped answering
+int StreamCommand (char *buffer)
+{
+    int length = (int)strlen(buffer);
+    int slot, end;
+
+    if (streamFailed)
+    {
+        return (-1);
+    }
+
+    if (length > GRBL_RX_BUFFER_SIZE)
+    {
+        printf("Line is longer than the controller buffer: %s\n", buffer);
+        return (-1);
+    }
+
+    while ( (streamBytes + length > GRBL_RX_BUFFER_SIZE) || (streamCount == STREAM_MAX_LINES) )
+    {
+        if (CollectReplies() < 0)
+            return (-1);
+    }
+
+    slot = (streamHead + streamCount) % STREAM_MAX_LINES;
+    end = length;
+    while ( (end > 0) && ((buffer[end-1] == '\n') || (buffer[end-1] == '\r')) )
+        end--;                                  // Keep the copy without its line ending
+    memcpy(streamLine[slot], buffer, end);
+    streamLine[slot][end] = 0;
+    streamLength[slot] = length;
+    streamCount++;
+    streamBytes += length;
+
+    if (TransmitCommand(buffer, length) != 0)
+    {
+        streamFailed = 1;
+        return (-1);
+    }
+    txCommands++;
+    txBytes += length;
+    return (0);
+}
+
+// Wait for the answers to every line still in the controller buffer
+// Returns: number of lines the controller answered with "error" since the start, -1 if the robot stopped answering
+int FlushCommands (void)
+{
+    while ( (streamCount > 0) && !streamFailed )
+    {
+        CollectReplies();
+    }
+    return streamFailed ? -1 : streamErrors;
+}
+
+// Returns: 1 once the robot has stopped answering and streaming was abandoned
+int StreamFailed (void)
+{
+    return (streamFailed);
+}
+
+// Print how many write calls it took to stream the job
+void ReportTransmitStats (void)
+{
+    printf("Serial: %lu commands, %lu bytes in %lu write calls",
+           txCommands, txBytes, txWrites);
+    if (txWrites > 0)
+        printf(" (%.1f bytes per call)", (double)txBytes / (double)txWrites);
+    printf("\n");
+}
+
+
 
 
@@ -9,10 +9,20 @@
 #define cport_nr    5                  /* COM number minus 1 */
 #define bdrate      115200              /* 115200  */
 
+#define GRBL_RX_BUFFER_SIZE 128                 /* Bytes in GRBL's serial receive buffer */
+#define STREAM_MAX_LINES    128                 /* Most lines that can be unacknowledged at once */
+#define REPLY_TIMEOUT_MS    10000               /* Default wait for the robot to answer before giving up */
+
 int PrintBuffer (char *buffer);                 //JIB: Needed to match the function
-int WaitForReply (void);                        // Wit for OK function
-int WaitForDollar (void);                       // Wait for '$' function (for startup)
+int WaitForReply (int *replies, int maxReplies);    // Wait for ok/error replies, 0 = ok, else error code
+int WaitForDollar (void);                       // Wait for '$' function (for startup), -1 on timeout
+void SetReplyTimeout (int milliseconds);        // How long to wait for an answer from the robot
 int CanRS232PortBeOpened ( void );              // Port open check
 void CloseRS232Port (void);
+int StreamCommand (char *buffer);               // Send a line as soon as the controller has room for it
+int FlushCommands (void);                       // Wait until every streamed line is acknowledged
+int StreamFailed (void);                        // 1 once the robot has stopped answering
+int FlushTransmit (void);                       // Write the streamed commands not yet sent
+void ReportTransmitStats (void);                // Print commands, bytes and write calls of the job
 
 #endif // SERIAL_H_INCLUDED
@@ -0,0 +1,87 @@
+// BenchFormat: checks the fixed-point coordinate formatter against printf and times both
+//
+// Build from the project folder:
+//     gcc -O2 -o BenchFormat tools/BenchFormat.c GcodeFormat.c -lm
+// Usage:
+//     BenchFormat [values] [decimals]
+//
+// Every value is formatted both ways and compared before timing, so a difference is reported
+// with the value that caused it.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../GcodeFormat.h"
+
+// Helper function: a random coordinate like the ones a page produces, with an occasional exact tie or edge case
+static float RandomCoordinate(void)
+{
+    switch (rand() % 8)
+    {
+    case 0:  return (float)(rand() % 200001 - 100000) / 1024.0f;  // Multiples of 2^-10, includes exact ties at 3 decimals
+    case 1:  return -(float)(rand() % 1000) * 1e-6f;              // Tiny negatives that round to -0
+    default: return ((float)rand() / (float)RAND_MAX) * 300.0f - 150.0f;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    int count = (argc > 1) ? atoi(argv[1]) : 1000000;  // Values to format
+    int decimals = (argc > 2) ? atoi(argv[2]) : 3;     // Digits after the point
+    if (count < 1 || decimals < 0 || decimals > GCODE_MAX_DECIMALS)
+    {
+        printf("Usage: BenchFormat [values] [decimals 0-%d]\n", GCODE_MAX_DECIMALS);
+        return 1;
+    }
+
+    float *values = malloc(count * sizeof(float));
+    if (values == NULL)
+    {
+        printf("Out of memory\n");
+        return 1;
+    }
+    srand(1);
+    for (int i = 0; i < count; i++)
+    {
+        values[i] = RandomCoordinate();
+    }
+    values[0] = 0.0f;
+    if (count > 1) values[1] = -0.0f;
+
+    char expected[64], actual[GCODE_NUMBER_MAX];
+    int mismatches = 0;
+    for (int i = 0; i < count; i++)                    // Same text as printf for every value
+    {
+        sprintf(expected, "%.*f", decimals, values[i]);
+        FormatCoordinate(actual, values[i], decimals, 0);
+        if (strcmp(expected, actual) != 0 && mismatches++ < 10)
+        {
+            printf("Mismatch for %.9g: printf \"%s\", formatter \"%s\"\n", values[i], expected, actual);
+        }
+    }
+
+    unsigned long checksum = 0;                        // Keeps the compiler from dropping the work
+    clock_t start = clock();
+    for (int i = 0; i < count; i++)
+    {
+        checksum += (unsigned long)sprintf(expected, "%.*f", decimals, values[i]);
+    }
+    double printfSeconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    start = clock();
+    for (int i = 0; i < count; i++)
+    {
+        checksum += (unsigned long)(FormatCoordinate(actual, values[i], decimals, 0) - actual);
+    }
+    double formatSeconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("%d values at %d decimals: %s\n", count, decimals, mismatches ? "DIFFERENT from printf" : "identical to printf");
+    printf("printf:    %.1f ns per value\n", printfSeconds * 1e9 / count);
+    printf("formatter: %.1f ns per value (%.1fx faster, checksum %lu)\n",
+           formatSeconds * 1e9 / count, formatSeconds > 0.0 ? printfSeconds / formatSeconds : 0.0, checksum);
+
+    free(values);
+    return mismatches ? 1 : 0;
+}
@@ -0,0 +1,94 @@
+// BenchTransform: times the stroke transform kernel against the plain C version
+//
+// Build from the project folder (add -mavx2 to time the AVX2 path instead of SSE2):
+//     gcc -O2 -o BenchTransform tools/BenchTransform.c TransformStrokes.c StrokeArena.c LoadFontEmbedded.c SingleStrokeFontData.c -lm
+// Usage:
+//     BenchTransform [characters per line] [repetitions]
+//
+// Uses the font compiled into the program, so no font file is needed.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "../StrokeBuffer.h"
+
+// Helper function: runs one transform function 'repeat' times over the same line
+// Returns: seconds taken for all repetitions
+static double TimeTransform(int (*transform)(const GlyphInstance *, int, StrokeArena *, StrokeBuffer *),
+                            const GlyphInstance *chars, int nChars, int repeat, StrokeArena *arena, StrokeBuffer *strokes)
+{
+    clock_t start = clock();
+
+    for (int run = 0; run < repeat; run++)
+    {
+        StrokeArenaReset(arena);                 // Same memory every run, as for consecutive lines
+        transform(chars, nChars, arena, strokes);
+    }
+
+    return (double)(clock() - start) / CLOCKS_PER_SEC;
+}
+
+int main(int argc, char *argv[])
+{
+    int nChars = (argc > 1) ? atoi(argv[1]) : 4096;        // Characters in the benchmark line
+    int repeat = (argc > 2) ? atoi(argv[2]) : 2000;        // Times the line is transformed
+    if (nChars <= 0 || repeat <= 0)
+    {
+        printf("Usage: BenchTransform [characters per line] [repetitions]\n");
+        return 1;
+    }
+
+    FontTable font;
+    LoadFontEmbedded(&font);
+
+    GlyphInstance *chars = malloc((size_t)nChars * sizeof(GlyphInstance));
+    if (chars == NULL)
+    {
+        printf("Out of memory\n");
+        return 1;
+    }
+
+    // Lay out printable characters in order, placed as ScaleandAdjustStrokeData would at 6 mm
+    float scale = 6.0f / 18.0f;
+    float xPosition = 0.0f;
+    for (int charIdx = 0; charIdx < nChars; charIdx++)
+    {
+        int asciiValue = 33 + charIdx % 94;     // '!' to '~'
+        chars[charIdx].ascii = asciiValue;
+        chars[charIdx].glyph = &font.glyphs[asciiValue];
+        chars[charIdx].x = xPosition;
+        chars[charIdx].y = -11.0f * (float)(charIdx / 40);
+        chars[charIdx].scale = scale;
+        xPosition += chars[charIdx].glyph->advance * scale + 0.9f;
+    }
+
+    StrokeArena scalarArena, kernelArena;
+    StrokeBuffer scalar, kernel;
+    StrokeArenaInit(&scalarArena);
+    StrokeArenaInit(&kernelArena);
+
+    double scalarSeconds = TimeTransform(TransformStrokesScalar, chars, nChars, repeat, &scalarArena, &scalar);
+    double kernelSeconds = TimeTransform(TransformStrokes, chars, nChars, repeat, &kernelArena, &kernel);
+
+    // Both versions must agree exactly, point for point and on the bounding box
+    int match = (scalar.nPoints == kernel.nPoints) &&
+                memcmp(scalar.X, kernel.X, (size_t)scalar.nPoints * sizeof(float)) == 0 &&
+                memcmp(scalar.Y, kernel.Y, (size_t)scalar.nPoints * sizeof(float)) == 0 &&
+                memcmp(scalar.Z, kernel.Z, (size_t)scalar.nPoints) == 0 &&
+                scalar.minX == kernel.minX && scalar.maxX == kernel.maxX &&
+                scalar.minY == kernel.minY && scalar.maxY == kernel.maxY;
+
+    double points = (double)scalar.nPoints * repeat;
+    printf("%d characters, %d points per line, %d repetitions\n", nChars, scalar.nPoints, repeat);
+    printf("scalar : %8.3f s  %7.2f ns/point\n", scalarSeconds, 1e9 * scalarSeconds / points);
+    printf("kernel : %8.3f s  %7.2f ns/point  (%.2fx)\n", kernelSeconds, 1e9 * kernelSeconds / points,
+           (kernelSeconds > 0.0) ? scalarSeconds / kernelSeconds : 0.0);
+    printf("results %s\n", match ? "identical" : "DIFFER");
+
+    StrokeArenaFree(&scalarArena);
+    StrokeArenaFree(&kernelArena);
+    free(chars);
+    return match ? 0 : 1;
+}
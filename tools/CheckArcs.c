@@ -0,0 +1,189 @@
+// CheckArcs: checks that every arc FitArc accepts stays within the tolerance of the points it replaces
+//
+// Build from the project folder:
+//     gcc -O2 -o CheckArcs tools/CheckArcs.c FitArcs.c TransformStrokes.c StrokeArena.c LoadFontEmbedded.c SingleStrokeFontData.c -lm
+// Usage:
+//     CheckArcs [tolerance in mm] [font height in mm]
+//
+// Every printable character is laid out as ScaleandAdjustStrokeData would and its pen-down polylines are cut
+// into arcs the way ConvertStrokestoGcode does. Each arc is then compared with the segments it replaces in
+// both directions, by sampling: the arc as GRBL draws it (radius from the start point) against the segments,
+// and the segments against the arc. Without a font height the check runs at 4, 6 and 10 mm.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "../StrokeBuffer.h"
+
+#define ARC_SAMPLES     256              /* Points taken along each arc */
+#define SEGMENT_SAMPLES 32               /* Points taken along each replaced segment */
+#define CHECK_SLACK     1e-4             /* mm; float rounding in the fit itself */
+
+// Helper function: distance in mm from point (x, y) to the segment from (x0, y0) to (x1, y1)
+static double SegmentDistance(double x, double y, double x0, double y0, double x1, double y1)
+{
+    double dx = x1 - x0, dy = y1 - y0;
+    double lengthSquared = dx * dx + dy * dy;
+    double t = 0.0;
+
+    if (lengthSquared > 0.0)
+    {
+        t = ((x - x0) * dx + (y - y0) * dy) / lengthSquared;
+        if (t < 0.0) t = 0.0;
+        if (t > 1.0) t = 1.0;
+    }
+    return hypot(x0 + t * dx - x, y0 + t * dy - y);
+}
+
+// Helper function: point 'fraction' of the way along an arc from (startX, startY)
+static void ArcPoint(const StrokeArc *arc, double startX, double startY, double sweep, double fraction,
+                     double *x, double *y)
+{
+    double radius = hypot(startX - arc->centreX, startY - arc->centreY);
+    double angle = atan2(startY - arc->centreY, startX - arc->centreX) + fraction * sweep;
+    *x = arc->centreX + radius * cos(angle);
+    *y = arc->centreY + radius * sin(angle);
+}
+
+// Helper function: largest distance between an arc and the polyline first..arc->end it replaces
+// Returns: the distance in mm, measured both ways
+static double ArcDeviation(const StrokeBuffer *strokes, int first, const StrokeArc *arc)
+{
+    double startX = strokes->X[first], startY = strokes->Y[first];
+    double start = atan2(startY - arc->centreY, startX - arc->centreX);
+    double end = atan2(strokes->Y[arc->end] - arc->centreY, strokes->X[arc->end] - arc->centreX);
+    double sweep = arc->counterClockwise ? end - start : start - end;
+    if (sweep <= 0.0) sweep += 2.0 * M_PI;
+    if (!arc->counterClockwise) sweep = -sweep;
+
+    double arcX[ARC_SAMPLES + 1], arcY[ARC_SAMPLES + 1];
+    for (int sample = 0; sample <= ARC_SAMPLES; sample++)
+    {
+        ArcPoint(arc, startX, startY, sweep, (double)sample / ARC_SAMPLES, &arcX[sample], &arcY[sample]);
+    }
+
+    double worst = 0.0;
+    for (int sample = 0; sample <= ARC_SAMPLES; sample++)                // Arc against the segments
+    {
+        double nearest = INFINITY;
+        for (int pointIdx = first; pointIdx < arc->end; pointIdx++)
+        {
+            double distance = SegmentDistance(arcX[sample], arcY[sample], strokes->X[pointIdx], strokes->Y[pointIdx],
+                                              strokes->X[pointIdx + 1], strokes->Y[pointIdx + 1]);
+            if (distance < nearest) nearest = distance;
+        }
+        if (nearest > worst) worst = nearest;
+    }
+
+    for (int pointIdx = first; pointIdx < arc->end; pointIdx++)          // Segments against the arc
+    {
+        for (int sample = 0; sample <= SEGMENT_SAMPLES; sample++)
+        {
+            double t = (double)sample / SEGMENT_SAMPLES;
+            double x = strokes->X[pointIdx] + t * (strokes->X[pointIdx + 1] - strokes->X[pointIdx]);
+            double y = strokes->Y[pointIdx] + t * (strokes->Y[pointIdx + 1] - strokes->Y[pointIdx]);
+            double nearest = INFINITY;
+            for (int arcIdx = 0; arcIdx < ARC_SAMPLES; arcIdx++)
+            {
+                double distance = SegmentDistance(x, y, arcX[arcIdx], arcY[arcIdx], arcX[arcIdx + 1], arcY[arcIdx + 1]);
+                if (distance < nearest) nearest = distance;
+            }
+            if (nearest > worst) worst = nearest;
+        }
+    }
+    return worst;
+}
+
+// Helper function: fits arcs to every character at one font height and checks each of them
+// Returns: number of arcs further from their points than tolerance
+static int CheckHeight(const FontTable *font, float height, float tolerance, StrokeArena *arena)
+{
+    GlyphInstance chars[94];
+    float scale = height / 18.0f;
+    float xPosition = 0.0f;
+
+    for (int charIdx = 0; charIdx < 94; charIdx++)        // '!' to '~' on one line
+    {
+        chars[charIdx].ascii = 33 + charIdx;
+        chars[charIdx].glyph = &font->glyphs[33 + charIdx];
+        chars[charIdx].x = xPosition;
+        chars[charIdx].y = 0.0f;
+        chars[charIdx].scale = scale;
+        xPosition += chars[charIdx].glyph->advance * scale + 0.15f * height;
+    }
+
+    StrokeBuffer strokes;
+    StrokeArenaReset(arena);
+    if (TransformStrokes(chars, 94, arena, &strokes) < 0)
+    {
+        printf("Out of memory\n");
+        return 1;
+    }
+
+    int arcs = 0, failed = 0;
+    double worst = 0.0;
+    for (int pointIdx = 1; pointIdx < strokes.nPoints; pointIdx++)
+    {
+        if (!strokes.Z[pointIdx]) continue;
+
+        int runEnd = pointIdx;                            // Last pen-down point of this polyline
+        while (runEnd + 1 < strokes.nPoints && strokes.Z[runEnd + 1])
+        {
+            runEnd++;
+        }
+
+        StrokeArc arc;
+        if (FitArc(&strokes, pointIdx - 1, runEnd, tolerance, &arc) < 0)
+        {
+            continue;                                     // Drawn with G1, try an arc from the next point
+        }
+
+        double deviation = ArcDeviation(&strokes, pointIdx - 1, &arc);
+        arcs++;
+        if (deviation > worst) worst = deviation;
+        if (deviation > tolerance + CHECK_SLACK)
+        {
+            failed++;
+            printf("  arc from (%.3f, %.3f) to (%.3f, %.3f) strays %.4f mm\n", strokes.X[pointIdx - 1],
+                   strokes.Y[pointIdx - 1], strokes.X[arc.end], strokes.Y[arc.end], deviation);
+        }
+        pointIdx = arc.end;                               // Carry on after the arc's last point
+    }
+
+    printf("%4.1f mm: %d arcs, furthest %.4f mm from their points (tolerance %.3f mm)%s\n",
+           height, arcs, worst, tolerance, failed ? " - TOO FAR" : "");
+    return failed;
+}
+
+int main(int argc, char *argv[])
+{
+    float tolerance = (argc > 1) ? (float)atof(argv[1]) : 0.3f;    // Arc tolerance as given with -a
+    float height = (argc > 2) ? (float)atof(argv[2]) : 0.0f;       // Font height, 0 for 4, 6 and 10 mm
+    if (tolerance <= 0.0f || height < 0.0f)
+    {
+        printf("Usage: CheckArcs [tolerance in mm] [font height in mm]\n");
+        return 1;
+    }
+
+    FontTable font;
+    LoadFontEmbedded(&font);
+
+    StrokeArena arena;
+    StrokeArenaInit(&arena);
+
+    int failed = 0;
+    if (height > 0.0f)
+    {
+        failed += CheckHeight(&font, height, tolerance, &arena);
+    }
+    else
+    {
+        failed += CheckHeight(&font, 4.0f, tolerance, &arena);
+        failed += CheckHeight(&font, 6.0f, tolerance, &arena);
+        failed += CheckHeight(&font, 10.0f, tolerance, &arena);
+    }
+
+    StrokeArenaFree(&arena);
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,92 @@
+// EmbedFont: turns the text stroke font into a C source file of static const glyph tables
+//
+// Build and run from the project folder whenever SingleStrokeFont.txt changes:
+//     gcc -o EmbedFont tools/EmbedFont.c LoadFontTable.c FontBinary.c MapFile.c
+//     EmbedFont SingleStrokeFont.txt SingleStrokeFontData.c
+//
+// SingleStrokeFontData.c is compiled into the program and used by LoadFontEmbedded when no
+// font file is found in the working directory. The data lives in read-only memory.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../StrokeFont.h"
+
+int main(int argc, char *argv[])
+{
+    const char *textPath = (argc > 1) ? argv[1] : "SingleStrokeFont.txt";    // Text font to embed
+    const char *sourcePath = (argc > 2) ? argv[2] : "SingleStrokeFontData.c"; // C source to generate
+
+    FILE *stroke_data = fopen(textPath, "r");
+    if (stroke_data == NULL)
+    {
+        printf("Could not open %s\n", textPath);
+        return 1;
+    }
+
+    FontTable font;
+    int nGlyphs = LoadFontTable(stroke_data, &font);
+    fclose(stroke_data);
+    if (nGlyphs < 0)
+    {
+        printf("Could not read %s\n", textPath);
+        return 1;
+    }
+
+    FILE *out = fopen(sourcePath, "w");
+    if (out == NULL)
+    {
+        printf("Could not create %s\n", sourcePath);
+        FreeFontTable(&font);
+        return 1;
+    }
+
+    fprintf(out, "// Generated by tools/EmbedFont from %s - do not edit by hand\n\n", textPath);
+    fprintf(out, "#include <stddef.h>\n\n#include \"StrokeFont.h\"\n\n");
+
+    int written = 0;
+    fprintf(out, "static const StrokePoint EmbeddedPoints[%d] = {", font.nPoints > 0 ? font.nPoints : 1);
+    for (int asciiValue = 0; asciiValue < FONT_TABLE_SIZE; asciiValue++)
+    {
+        const GlyphData *glyph = &font.glyphs[asciiValue];
+        for (int moveIdx = 0; glyph->defined && moveIdx < glyph->nMoves; moveIdx++)
+        {
+            StrokePoint point = glyph->points[moveIdx];
+            fprintf(out, "%s%sSTROKE_POINT(%d, %d, %d)", (written > 0) ? "," : "", (written % 6 == 0) ? "\n    " : " ",
+                    STROKE_POINT_X(point), STROKE_POINT_Y(point), STROKE_POINT_PEN(point));
+            written++;
+        }
+    }
+    fprintf(out, "%s\n};\n\n", (written == 0) ? "\n    STROKE_POINT(0, 0, 0)" : "");
+
+    // Glyph table: defined, nMoves, pointer to the glyph's first point and the precomputed metrics
+    int start = 0;
+    fprintf(out, "const GlyphData EmbeddedFontGlyphs[FONT_TABLE_SIZE] = {\n");
+    for (int asciiValue = 0; asciiValue < FONT_TABLE_SIZE; asciiValue++)
+    {
+        const GlyphData *glyph = &font.glyphs[asciiValue];
+        if (glyph->defined)
+        {
+            fprintf(out, "    { 1, %d, EmbeddedPoints + %d, %.1ff, %.1ff, %.1ff, %.1ff, %.1ff },   // %d\n",
+                    glyph->nMoves, start,
+                    glyph->minX, glyph->maxX, glyph->minY, glyph->maxY, glyph->advance, asciiValue);
+            start += glyph->nMoves;
+        }
+        else
+        {
+            fprintf(out, "    { 0, 0, NULL, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f },   // %d\n", asciiValue);
+        }
+    }
+    fprintf(out, "};\n\nconst int EmbeddedFontPoints = %d;\n", font.nPoints);
+
+    int failed = (fclose(out) != 0);
+    FreeFontTable(&font);
+    if (failed)
+    {
+        printf("Could not write %s\n", sourcePath);
+        return 1;
+    }
+
+    printf("Embedded %d glyphs into %s\n", nGlyphs, sourcePath);
+    return 0;
+}
@@ -0,0 +1,526 @@
+// GrblSimulator: stands in for the GRBL pen plotter on a pseudo-terminal, so the serial path can be timed without hardware
+//
+// Build from the project folder (Linux/FreeBSD):
+//     gcc -O2 -o GrblSimulator tools/GrblSimulator.c -lm
+// Usage:
+//     GrblSimulator [-b rx_bytes] [-q planner_blocks] [-r rapid_mm_per_min] [-t time_scale] [-p pen_ms] [-l link] [-v]
+//         -b  size of the serial receive buffer (default 128, as in GRBL)
+//         -q  moves the planner can hold (default 15, GRBL's 16 block ring keeps one free)
+//         -r  feed rate used for G0 moves (default 3000 mm/min)
+//         -t  multiplies every move time, 0 answers as fast as the lines arrive (default 1 = real time)
+//         -p  time the pen servo takes for every S or M3/M5 command (default 0 ms)
+//         -l  also make a symbolic link to the pseudo-terminal, e.g. /tmp/ttyGRBL
+//         -v  print every line received
+// Then build the drawing program with -DSerial_Mode and point it at the printed device:
+//     GRBL_PORT=/tmp/ttyGRBL ./main
+//
+// As far as the sender can tell it behaves like GRBL 1.1: a banner when a program connects, "ok" once a
+// line has been taken out of the receive buffer and planned, "error:N" for lines it cannot run, '?' status
+// reports and Ctrl-X resets. A line is only taken out of the receive buffer when the planner has room,
+// and pen commands wait for the planner to empty as GRBL does with spindle commands, so a sender that
+// ignores the buffer size loses bytes here just as it would on the robot. Each move takes its length
+// divided by its feed rate; acceleration is not modelled. Job statistics are printed when the program
+// disconnects: how long the machine was busy and how long the planner sat empty waiting for lines.
+
+#define _XOPEN_SOURCE 600
+#define _DEFAULT_SOURCE
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <math.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <termios.h>
+#include <unistd.h>
+
+#define MAX_RX_BUFFER   4096           /* Largest receive buffer that can be configured */
+#define MAX_PLANNER     64             /* Largest planner that can be configured */
+#define MAX_LINE        256            /* Longest line kept, GRBL's own limit is 80 */
+
+// Simulator settings from the command line
+typedef struct {
+    int rxSize;                        // Receive buffer bytes
+    int plannerSize;                   // Planner blocks
+    double rapidRate;                  // mm/min for G0
+    double timeScale;                  // Multiplier for every move time
+    double penSeconds;                 // Time taken by each pen command
+    int verbose;                       // Print every line received
+} Settings;
+
+// Machine and job state, reset when a program connects
+typedef struct {
+    unsigned char rx[MAX_RX_BUFFER];   // Receive buffer, bytes not yet taken out as a line
+    int rxHead, rxCount;
+    double blockEnd[MAX_PLANNER];      // Time each planned move finishes, in order
+    int plannerHead, plannerCount;
+    double lastEnd;                    // Time the most recently planned move finishes
+    double x, y;                       // Position after the last planned move
+    int motion;                        // Modal motion mode: 0, 1, 2 or 3
+    int relative;                      // G91 in effect
+    double feed;                       // Modal feed rate, mm/min
+    int connected;                     // A program has sent something since the last reset
+
+    unsigned long lines, bytes, errors, lost;   // Job statistics
+    int peakRx;
+    double firstStart, busy, starved;
+} Machine;
+
+static Settings settings = {128, 15, 3000.0, 1.0, 0.0, 0};
+static Machine machine;
+
+static double Now(void)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// Helper function: writes a reply to the program, the pseudo-terminal buffers far more than GRBL ever sends
+static void Reply(int master, const char *text)
+{
+    size_t length = strlen(text);
+    while (length > 0)
+    {
+        ssize_t n = write(master, text, length);
+        if (n < 0)
+        {
+            if (errno == EAGAIN || errno == EINTR) continue;
+            return;
+        }
+        text += n;
+        length -= (size_t)n;
+    }
+}
+
+static void ResetMachine(void)
+{
+    memset(&machine, 0, sizeof(machine));
+    machine.motion = 0;
+    machine.lastEnd = Now();
+}
+
+static void PrintJobStats(void)
+{
+    if (machine.lines == 0)
+    {
+        return;
+    }
+
+    double elapsed = machine.lastEnd - machine.firstStart;
+    printf("Job: %lu lines, %lu bytes, %lu errors, %lu bytes lost to receive buffer overflow (peak %d/%d bytes)\n",
+           machine.lines, machine.bytes, machine.errors, machine.lost, machine.peakRx, settings.rxSize);
+    printf("     machine busy %.3f s of %.3f s (%.1f%%), planner empty %.3f s waiting for lines\n",
+           machine.busy, elapsed, elapsed > 0.0 ? 100.0 * machine.busy / elapsed : 100.0, machine.starved);
+    fflush(stdout);
+}
+
+// Helper function: removes moves that have finished from the planner
+static void RunPlanner(double now)
+{
+    while (machine.plannerCount > 0 && machine.blockEnd[machine.plannerHead] <= now)
+    {
+        machine.plannerHead = (machine.plannerHead + 1) % MAX_PLANNER;
+        machine.plannerCount--;
+    }
+}
+
+// Helper function: adds a move (or pen wait) of 'seconds' to the planner, after everything already planned
+static void PlanBlock(double seconds, double now)
+{
+    seconds *= settings.timeScale;
+
+    double start = machine.lastEnd;
+    if (machine.plannerCount == 0)
+    {
+        if (machine.busy > 0.0 && now > start)
+        {
+            machine.starved += now - start;    // The machine stood still waiting for this line
+        }
+        start = now;
+    }
+    if (machine.busy == 0.0 && seconds > 0.0)
+    {
+        machine.firstStart = start;
+    }
+
+    machine.lastEnd = start + seconds;
+    machine.busy += seconds;
+    machine.blockEnd[(machine.plannerHead + machine.plannerCount) % MAX_PLANNER] = machine.lastEnd;
+    machine.plannerCount++;
+}
+
+// Helper function: length of a G2 (clockwise) or G3 arc from the current position to (x, y) around centre (cx, cy)
+static double ArcLength(double x, double y, double cx, double cy, int clockwise)
+{
+    double radius = hypot(machine.x - cx, machine.y - cy);
+    double start = atan2(machine.y - cy, machine.x - cx);
+    double end = atan2(y - cy, x - cx);
+    double sweep = clockwise ? start - end : end - start;
+
+    if (sweep <= 1e-9) sweep += 2.0 * M_PI;    // Same start and end point is a full circle
+    return radius * sweep;
+}
+
+// Helper function: runs one line taken out of the receive buffer
+// Returns: 0 for "ok", otherwise the GRBL error number
+static int ExecuteLine(char *line, double now)
+{
+    double value[26];
+    int seen[26] = {0};
+    int gCodes[8], nG = 0;
+    int mCodes[4], nM = 0;
+    char *p = line;
+
+    while (*p)
+    {
+        int letter = toupper((unsigned char)*p);
+        if (letter < 'A' || letter > 'Z') return 1;    // Expected command letter
+        char digits[32];
+        int n = 0;
+        p++;
+        while ((isdigit((unsigned char)*p) || *p == '.' || ((*p == '-' || *p == '+') && n == 0)) && n < 31)
+        {
+            digits[n++] = *p++;                        // strtod alone would read "0X6" in "G0X6" as hex
+        }
+        digits[n] = 0;
+        char *end;
+        double number = strtod(digits, &end);
+        if (n == 0 || *end != 0) return 2;             // Bad number format
+
+        if (letter == 'G')
+        {
+            if (nG == 8) return 20;
+            gCodes[nG++] = (int)number;
+        }
+        else if (letter == 'M')
+        {
+            if (nM == 4) return 20;
+            mCodes[nM++] = (int)number;
+        }
+        else if (strchr("FIJNPSXYZ", letter) != NULL)
+        {
+            value[letter - 'A'] = number;
+            seen[letter - 'A'] = 1;
+        }
+        else
+        {
+            return 20;                                 // Unsupported command
+        }
+    }
+
+    double dwell = -1.0;
+    int penCommand = seen['S' - 'A'];
+    for (int i = 0; i < nG; i++)
+    {
+        switch (gCodes[i])
+        {
+        case 0: case 1: case 2: case 3: machine.motion = gCodes[i]; break;
+        case 4:  dwell = seen['P' - 'A'] ? value['P' - 'A'] : 0.0; break;
+        case 90: machine.relative = 0; break;
+        case 91: machine.relative = 1; break;
+        case 17: case 21: case 94: break;              // Already the only plane, unit and feed mode
+        default: return 20;
+        }
+    }
+    for (int i = 0; i < nM; i++)
+    {
+        if (mCodes[i] == 3 || mCodes[i] == 4 || mCodes[i] == 5) penCommand = 1;
+        else if (mCodes[i] != 2 && mCodes[i] != 30) return 20;
+    }
+    if (seen['F' - 'A'])
+    {
+        if (value['F' - 'A'] <= 0.0) return 2;
+        machine.feed = value['F' - 'A'];
+    }
+
+    if (penCommand && settings.penSeconds > 0.0)
+    {
+        PlanBlock(settings.penSeconds, now);
+    }
+    if (dwell >= 0.0)
+    {
+        PlanBlock(dwell, now);
+        return 0;
+    }
+
+    if (!seen['X' - 'A'] && !seen['Y' - 'A'])
+    {
+        return 0;                                      // No motion on this line
+    }
+
+    double x = machine.x, y = machine.y;
+    if (seen['X' - 'A']) x = machine.relative ? machine.x + value['X' - 'A'] : value['X' - 'A'];
+    if (seen['Y' - 'A']) y = machine.relative ? machine.y + value['Y' - 'A'] : value['Y' - 'A'];
+
+    double length, rate;
+    if (machine.motion == 0)
+    {
+        length = hypot(x - machine.x, y - machine.y);
+        rate = settings.rapidRate;
+    }
+    else
+    {
+        if (machine.feed <= 0.0) return 22;            // Feed rate has not yet been set
+        rate = machine.feed;
+        if (machine.motion == 1)
+        {
+            length = hypot(x - machine.x, y - machine.y);
+        }
+        else
+        {
+            if (!seen['I' - 'A'] && !seen['J' - 'A']) return 26;    // Arc without offsets
+            double cx = machine.x + (seen['I' - 'A'] ? value['I' - 'A'] : 0.0);
+            double cy = machine.y + (seen['J' - 'A'] ? value['J' - 'A'] : 0.0);
+            double radiusError = fabs(hypot(x - cx, y - cy) - hypot(machine.x - cx, machine.y - cy));
+            if (radiusError > 0.005 && radiusError > 0.001 * hypot(x - cx, y - cy)) return 33;   // End point not on the arc
+            length = ArcLength(x, y, cx, cy, machine.motion == 2);
+        }
+    }
+
+    if (length > 0.0)
+    {
+        PlanBlock(length / rate * 60.0, now);
+    }
+    machine.x = x;
+    machine.y = y;
+    return 0;
+}
+
+// Helper function: checks for an S word or M3/M4/M5, which move the pen servo
+static int IsPenCommand(const char *line)
+{
+    for (const char *p = line; *p; p++)
+    {
+        int letter = toupper((unsigned char)*p);
+        if (letter == 'S') return 1;
+        if (letter == 'M')
+        {
+            int code = atoi(p + 1);
+            if (code >= 3 && code <= 5) return 1;
+        }
+    }
+    return 0;
+}
+
+// Helper function: takes complete lines out of the receive buffer while the planner has room for them
+// Pen commands also wait for the planner to empty, like GRBL's spindle synchronisation
+static void ProcessLines(int master, double now)
+{
+    RunPlanner(now);
+
+    while (machine.rxCount > 0 && machine.plannerCount < settings.plannerSize)
+    {
+        int length = -1;
+        for (int i = 0; i < machine.rxCount; i++)
+        {
+            unsigned char c = machine.rx[(machine.rxHead + i) % settings.rxSize];
+            if (c == '\n' || c == '\r')
+            {
+                length = i;
+                break;
+            }
+        }
+        if (length < 0)
+        {
+            return;                                    // Line still arriving
+        }
+
+        char line[MAX_LINE];
+        int kept = 0, comment = 0;
+        for (int i = 0; i < length; i++)               // Copy without spaces and comments
+        {
+            char c = (char)machine.rx[(machine.rxHead + i) % settings.rxSize];
+            if (c == '(') comment = 1;
+            else if (c == ')') comment = 0;
+            else if (c == ';') comment = 2;
+            else if (!comment && c != ' ' && kept < MAX_LINE - 1) line[kept++] = c;
+        }
+        line[kept] = 0;
+
+        if (IsPenCommand(line) && machine.plannerCount > 0)
+        {
+            return;                                    // Pen command waits until every move has finished
+        }
+
+        machine.rxHead = (machine.rxHead + length + 1) % settings.rxSize;
+        machine.rxCount -= length + 1;
+
+        if (kept == 0 || line[0] == '$')
+        {
+            Reply(master, "ok\r\n");                   // Empty line or a setting: nothing to run
+            continue;
+        }
+
+        if (settings.verbose) printf("> %s\n", line);
+        machine.lines++;
+
+        int error = ExecuteLine(line, now);
+        if (error == 0)
+        {
+            Reply(master, "ok\r\n");
+        }
+        else
+        {
+            char text[32];
+            sprintf(text, "error:%d\r\n", error);
+            Reply(master, text);
+            machine.errors++;
+        }
+    }
+}
+
+// Helper function: handles bytes from the program; real-time commands never enter the receive buffer
+static void ReceiveBytes(int master, const unsigned char *bytes, int count, double now)
+{
+    for (int i = 0; i < count; i++)
+    {
+        unsigned char c = bytes[i];
+
+        if (!machine.connected)
+        {
+            machine.connected = 1;                     // GRBL resets when the port opens and greets the sender
+            Reply(master, "\r\nGrbl 1.1h ['$' for help]\r\n");
+        }
+
+        if (c == '?')
+        {
+            char status[96];
+            RunPlanner(now);
+            sprintf(status, "<%s|MPos:%.3f,%.3f,0.000|Bf:%d,%d>\r\n", machine.plannerCount ? "Run" : "Idle",
+                    machine.x, machine.y, settings.plannerSize - machine.plannerCount, settings.rxSize - machine.rxCount);
+            Reply(master, status);
+            continue;
+        }
+        if (c == 0x18)                                 // Ctrl-X soft reset
+        {
+            PrintJobStats();
+            ResetMachine();
+            machine.connected = 1;
+            Reply(master, "\r\nGrbl 1.1h ['$' for help]\r\n");
+            continue;
+        }
+
+        machine.bytes++;
+        if (machine.rxCount == settings.rxSize)
+        {
+            machine.lost++;                            // The sender overran the receive buffer
+            continue;
+        }
+        machine.rx[(machine.rxHead + machine.rxCount) % settings.rxSize] = c;
+        machine.rxCount++;
+        if (machine.rxCount > machine.peakRx) machine.peakRx = machine.rxCount;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    const char *link = NULL;
+    int option;
+
+    while ((option = getopt(argc, argv, "b:q:r:t:p:l:v")) != -1)
+    {
+        switch (option)
+        {
+        case 'b': settings.rxSize = atoi(optarg); break;
+        case 'q': settings.plannerSize = atoi(optarg); break;
+        case 'r': settings.rapidRate = atof(optarg); break;
+        case 't': settings.timeScale = atof(optarg); break;
+        case 'p': settings.penSeconds = atof(optarg) / 1000.0; break;
+        case 'l': link = optarg; break;
+        case 'v': settings.verbose = 1; break;
+        default:
+            fprintf(stderr, "Usage: %s [-b rx_bytes] [-q planner_blocks] [-r rapid_mm_per_min] [-t time_scale] [-p pen_ms] [-l link] [-v]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (settings.rxSize < 16 || settings.rxSize > MAX_RX_BUFFER || settings.plannerSize < 1 || settings.plannerSize > MAX_PLANNER ||
+        settings.rapidRate <= 0.0 || settings.timeScale < 0.0 || settings.penSeconds < 0.0)
+    {
+        fprintf(stderr, "Settings out of range (rx 16-%d bytes, planner 1-%d blocks)\n", MAX_RX_BUFFER, MAX_PLANNER);
+        return 1;
+    }
+
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+    if (master < 0 || grantpt(master) != 0 || unlockpt(master) != 0)
+    {
+        perror("unable to create a pseudo-terminal");
+        return 1;
+    }
+    const char *device = ptsname(master);
+
+    int slave = open(device, O_RDWR | O_NOCTTY);       // Raw mode from the start, so nothing is echoed back
+    if (slave >= 0)
+    {
+        struct termios raw;
+        if (tcgetattr(slave, &raw) == 0)
+        {
+            cfmakeraw(&raw);
+            tcsetattr(slave, TCSANOW, &raw);
+        }
+        close(slave);
+    }
+    fcntl(master, F_SETFL, fcntl(master, F_GETFL) | O_NONBLOCK);
+
+    if (link != NULL)
+    {
+        unlink(link);
+        if (symlink(device, link) != 0)
+        {
+            perror("unable to create the link");
+            return 1;
+        }
+    }
+    printf("Simulated GRBL on %s%s%s (rx %d bytes, planner %d blocks, time scale %g)\n", device,
+           link ? " linked from " : "", link ? link : "", settings.rxSize, settings.plannerSize, settings.timeScale);
+    fflush(stdout);
+
+    ResetMachine();
+
+    while (1)
+    {
+        double now = Now();
+        int timeout = -1;
+        ProcessLines(master, now);                     // Lines held back for a pen command go on once the planner empties
+        if (machine.plannerCount > 0)                  // Wake up when the running move finishes
+        {
+            timeout = (int)ceil((machine.blockEnd[machine.plannerHead] - now) * 1000.0);
+            if (timeout < 0) timeout = 0;
+        }
+
+        struct pollfd pfd = {master, POLLIN, 0};
+        int ready = poll(&pfd, 1, timeout);
+        if (ready < 0 && errno != EINTR)
+        {
+            perror("poll");
+            return 1;
+        }
+
+        now = Now();
+        if (ready > 0 && (pfd.revents & POLLIN))
+        {
+            unsigned char bytes[1024];
+            ssize_t n = read(master, bytes, sizeof(bytes));
+            if (n > 0)
+            {
+                ReceiveBytes(master, bytes, (int)n, now);
+            }
+        }
+        else if (ready > 0 && (pfd.revents & POLLHUP))
+        {
+            if (machine.connected)                     // The program closed the port: the job is over
+            {
+                PrintJobStats();
+                ResetMachine();
+            }
+            struct timespec pause = {0, 20000000};     // No program attached, check again in 20 ms
+            nanosleep(&pause, NULL);
+            continue;
+        }
+
+        ProcessLines(master, now);
+    }
+}
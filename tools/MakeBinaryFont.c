@@ -0,0 +1,58 @@
+// MakeBinaryFont: converts the text stroke font into the binary font format that main.c memory-maps
+//
+// Build from the project folder:
+//     gcc -o MakeBinaryFont tools/MakeBinaryFont.c LoadFontTable.c FontBinary.c MapFile.c
+// Usage:
+//     MakeBinaryFont [SingleStrokeFont.txt] [SingleStrokeFont.bin]
+//
+// The binary file is written in the byte order of the machine running the converter,
+// so run it on (or for) the machine that will draw.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "../StrokeFont.h"
+
+int main(int argc, char *argv[])
+{
+    const char *textPath = (argc > 1) ? argv[1] : "SingleStrokeFont.txt";  // Text font to convert
+    const char *binaryPath = (argc > 2) ? argv[2] : "SingleStrokeFont.bin"; // Binary font to write
+
+    FILE *stroke_data = fopen(textPath, "r");
+    if (stroke_data == NULL)
+    {
+        printf("Could not open %s\n", textPath);
+        return 1;
+    }
+
+    FontTable font;
+    int nGlyphs = LoadFontTable(stroke_data, &font);    // Parse the text font once
+    fclose(stroke_data);
+    if (nGlyphs < 0)
+    {
+        printf("Could not read %s\n", textPath);
+        return 1;
+    }
+
+    FILE *out = fopen(binaryPath, "wb");
+    if (out == NULL)
+    {
+        printf("Could not create %s\n", binaryPath);
+        FreeFontTable(&font);
+        return 1;
+    }
+
+    int failed = SaveFontBinary(out, &font);             // Write header, offset table and packed points
+    if (fclose(out) != 0) failed = -1;
+    if (failed)
+    {
+        printf("Could not write %s\n", binaryPath);
+        remove(binaryPath);                               // Do not leave a half written font behind
+        FreeFontTable(&font);
+        return 1;
+    }
+
+    printf("Wrote %d glyphs (%d stroke points) to %s\n", nGlyphs, font.nPoints, binaryPath);
+    FreeFontTable(&font);
+    return 0;
+}